@@ -7,6 +7,11 @@ SIZE_RATIO=2
 
 ################################################################################
 #
+# Note: the suite can run a size sweep in one process with
+#     raja-perf.exe --size-sweep <min>:<max>:<ratio>
+# which also writes a combined size sweep report. This script runs one
+# process per size, e.g. to compare several executables.
+#
 # Usage:
 #     srun -n1 --exclusive sweep.sh -x raja-perf.exe [-- <raja perf args>]
 #
@@ -48,6 +48,10 @@ int main( int argc, char** argv )
   // STEP 5: Generate suite execution reports
   executor.outputRunData();
 
+  // STEP 6: Non-zero exit status if there was a regression relative to
+  //         a previous run
+  int exit_status = executor.getExitStatus();
+
   rajaperf::getCout() << "\n\nDONE!!!...." << std::endl;
 
 #ifdef RUN_KOKKOS
@@ -57,5 +61,5 @@ int main( int argc, char** argv )
   MPI_Finalize();
 #endif
 
-  return 0;
+  return exit_status;
 }
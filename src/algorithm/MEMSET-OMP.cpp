@@ -18,7 +18,8 @@ namespace algorithm
 {
 
 
-void MEMSET::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void MEMSET::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -35,10 +36,11 @@ void MEMSET::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          MEMSET_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            MEMSET_BODY;
+          }
+        )
 
       }
       stopTimer();
@@ -55,10 +57,11 @@ void MEMSET::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          memset_lambda(i);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            memset_lambda(i);
+          }
+        )
 
       }
       stopTimer();
@@ -71,7 +74,7 @@ void MEMSET::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
             MEMSET_BODY;
@@ -94,5 +97,23 @@ void MEMSET::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+void MEMSET::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
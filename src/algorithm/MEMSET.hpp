@@ -60,6 +60,8 @@ public:
   void setHipTuningDefinitions(VariantID vid);
   void runSeqVariantDefault(VariantID vid);
   void runSeqVariantLibrary(VariantID vid);
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
 
   template < size_t block_size >
   void runCudaVariantBlock(VariantID vid);
@@ -18,7 +18,8 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void REDUCE_SUM::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -37,10 +38,11 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
         Real_type sum = m_sum_init;
 
-        #pragma omp parallel for reduction(+:sum)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE_SUM_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:sum),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE_SUM_BODY;
+          }
+        )
 
         m_sum = sum;
 
@@ -61,10 +63,11 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
         Real_type sum = m_sum_init;
 
-        #pragma omp parallel for reduction(+:sum)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          sum += sumreduce_base_lam(i);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:sum),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            sum += sumreduce_base_lam(i);
+          }
+        )
 
         m_sum = sum;
 
@@ -81,7 +84,7 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
         RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sum(m_sum_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
             REDUCE_SUM_BODY;
@@ -106,5 +109,23 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif
 }
 
+void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "REDUCE_SUM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+template < size_t width, size_t unroll >
+void REDUCE_SUM::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_SUM_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type sum = m_sum_init;
+
+      pack vsum[unroll];
+      for (size_t u = 0; u < unroll; ++u) {
+        vsum[u] = pack(0.0);
+      }
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t u) {
+          vsum[u] = vsum[u] + pack::load(&x[i]);
+        },
+        [&](Index_type i) {
+          REDUCE_SUM_BODY;
+        });
+
+      for (size_t u = 0; u < unroll; ++u) {
+        sum += reduce_sum(vsum[u]);
+      }
+
+      m_sum = sum;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  REDUCE_SUM : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(REDUCE_SUM)
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
@@ -39,6 +39,8 @@ REDUCE_SUM::REDUCE_SUM(const RunParams& params)
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_SIMD );
+
   setVariantDefined( Base_OpenMP );
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
@@ -54,19 +54,25 @@ public:
   void tearDown(VariantID vid, size_t tune_idx);
 
   void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSIMDTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t width, size_t unroll >
+  void runSIMDVariantImpl(VariantID vid);
   void runCudaVariantCub(VariantID vid);
   void runHipVariantRocprim(VariantID vid);
   template < size_t block_size >
   void runCudaVariantBlock(VariantID vid);
   template < size_t block_size >
   void runHipVariantBlock(VariantID vid);
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <vector>
 
@@ -18,7 +20,7 @@ namespace rajaperf
 namespace algorithm
 {
 
-void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SCAN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -185,5 +187,199 @@ void SCAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void SCAN::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  const Index_type block_size = cache_block_size;
+  ::std::vector<Real_type> block_sums(omp_get_max_threads());
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      //
+      // In each round, each thread sums one block, then scans it starting
+      // from the sum of all earlier blocks while it is still in cache.
+      //
+      #pragma omp parallel
+      {
+        const Index_type nt = omp_get_num_threads();
+        const Index_type t = omp_get_thread_num();
+
+        Real_type round_begin_sum = 0.0;
+        for (Index_type round_begin = ibegin; round_begin < iend;
+             round_begin += nt*block_size) {
+
+          const Index_type local_begin = std::min(round_begin + t*block_size, iend);
+          const Index_type local_end = std::min(local_begin + block_size, iend);
+
+          Real_type block_sum = 0.0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            block_sum += x[i];
+          }
+          block_sums[t] = block_sum;
+
+          #pragma omp barrier
+
+          Real_type scan_var = round_begin_sum;
+          for (Index_type tt = 0; tt < t; ++tt) {
+            scan_var += block_sums[tt];
+          }
+          for (Index_type tt = 0; tt < nt; ++tt) {
+            round_begin_sum += block_sums[tt];
+          }
+
+          #pragma omp barrier
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            SCAN_BODY;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SCAN : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SCAN::runOpenMPVariantLookBack(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  // what each block has posted: nothing, its sum, or its sum plus the sums
+  // of all blocks before it
+  constexpr int posted_none = 0;
+  constexpr int posted_sum = 1;
+  constexpr int posted_prefix = 2;
+
+  const Index_type block_size = cache_block_size;
+  const Index_type num_blocks = (iend - ibegin + block_size - 1) / block_size;
+  ::std::vector<std::atomic<int>> block_posted(num_blocks);
+  ::std::vector<Real_type> block_sums(num_blocks);
+  ::std::vector<Real_type> block_prefix_sums(num_blocks);
+  std::atomic<Index_type> next_block;
+
+  if ( vid == Base_OpenMP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (std::atomic<int>& posted : block_posted) {
+        posted.store(posted_none, std::memory_order_relaxed);
+      }
+      next_block.store(0, std::memory_order_relaxed);
+
+      //
+      // Threads take blocks in order. Each sums its block and posts the sum,
+      // then adds up sums posted by earlier blocks until it reaches one that
+      // posted its prefix sum, posts its own prefix sum, and scans its block
+      // while it is still in cache. Blocks before a block are always taken
+      // by running threads, so waiting for them to post ends.
+      //
+      #pragma omp parallel
+      {
+        for (Index_type b = next_block.fetch_add(1); b < num_blocks;
+             b = next_block.fetch_add(1)) {
+
+          const Index_type local_begin = ibegin + b*block_size;
+          const Index_type local_end = std::min(local_begin + block_size, iend);
+
+          Real_type block_sum = 0.0;
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            block_sum += x[i];
+          }
+
+          Real_type scan_var = 0.0;
+          if (b > 0) {
+            block_sums[b] = block_sum;
+            block_posted[b].store(posted_sum, std::memory_order_release);
+
+            for (Index_type pb = b-1; ; --pb) {
+              int posted = block_posted[pb].load(std::memory_order_acquire);
+              while (posted == posted_none) {
+                posted = block_posted[pb].load(std::memory_order_acquire);
+              }
+              if (posted == posted_prefix) {
+                scan_var += block_prefix_sums[pb];
+                break;
+              }
+              scan_var += block_sums[pb];
+            }
+          }
+          block_prefix_sums[b] = scan_var + block_sum;
+          block_posted[b].store(posted_prefix, std::memory_order_release);
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            SCAN_BODY;
+          }
+        }
+      }
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SCAN : Unknown OpenMP variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void SCAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if (vid == Base_OpenMP && tune_idx == 1) {
+
+    runOpenMPVariantBlocked(vid);
+
+  } else if (vid == Base_OpenMP && tune_idx == 2) {
+
+    runOpenMPVariantLookBack(vid);
+
+  } else {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void SCAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+    // same order as tunings in runOpenMPVariant
+    addVariantTuningName(vid, "default");
+    addVariantTuningName(vid, "blocked");
+    addVariantTuningName(vid, "lookback");
+  } else {
+    // RAJA scans split work across threads themselves, so schedule
+    // tunings would not change these loops
+    addVariantTuningName(vid, getDefaultTuningName());
+  }
+}
+#endif
+
 } // end namespace algorithm
 } // end namespace rajaperf
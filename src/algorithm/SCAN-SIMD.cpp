@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+template < size_t width, size_t unroll >
+void SCAN::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      SCAN_PROLOGUE;
+
+      // scan each pack in registers, then add the sum of earlier packs
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t) {
+          const pack xv = pack::load(&x[i]);
+          (pack(scan_var) + scan_exclusive(xv)).store(&y[i]);
+          scan_var += reduce_sum(xv);
+        },
+        [&](Index_type i) {
+          SCAN_BODY;
+        });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  SCAN : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(SCAN)
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
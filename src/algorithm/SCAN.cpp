@@ -42,6 +42,8 @@ SCAN::SCAN(const RunParams& params)
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_SIMD );
+
   setVariantDefined( Base_OpenMP );
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
@@ -61,6 +63,20 @@ SCAN::~SCAN()
 {
 }
 
+Index_type SCAN::getBytesMovedPerRep(VariantID vid, size_t tune_idx) const
+{
+#if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#else
+  // default OpenMP scans read and write y again to add earlier thread sums
+  if ( (vid == Base_OpenMP && tune_idx == 0) || vid == Lambda_OpenMP ) {
+    return getBytesPerRep() + 2*sizeof(Real_type)*getActualProblemSize();
+  }
+#endif
+  return getBytesPerRep();
+}
+
 void SCAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitDataRandValue(m_x, getActualProblemSize(), vid);
@@ -56,15 +56,31 @@ public:
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
+  Index_type getBytesMovedPerRep(VariantID vid, size_t tune_idx) const;
+
   void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSIMDTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < size_t width, size_t unroll >
+  void runSIMDVariantImpl(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBlocked(VariantID vid);
+  void runOpenMPVariantLookBack(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 0;
 
+  // elements in each block of blocked and look-back OpenMP scans, small
+  // enough that a block is still in cache when it is scanned after it is
+  // summed
+  static const Index_type cache_block_size = 8192;
+
   Real_ptr m_x;
   Real_ptr m_y;
 };
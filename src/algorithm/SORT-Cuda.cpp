@@ -22,10 +22,11 @@ namespace algorithm
 {
 
 #define SORT_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, iend*run_reps);
+  Real_ptr x_host = x; \
+  allocAndInitCudaDeviceData(x, x_host, iend*run_reps);
 
 #define SORT_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_x, x, iend*run_reps); \
+  getCudaDeviceData(x_host, x, iend*run_reps); \
   deallocCudaDeviceData(x);
 
 
@@ -22,10 +22,11 @@ namespace algorithm
 {
 
 #define SORT_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, iend*run_reps);
+  Real_ptr x_host = x; \
+  allocAndInitHipDeviceData(x, x_host, iend*run_reps);
 
 #define SORT_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_x, x, iend*run_reps); \
+  getHipDeviceData(x_host, x, iend*run_reps); \
   deallocHipDeviceData(x);
 
 
@@ -6,10 +6,13 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+
 #include "SORT.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +21,7 @@ namespace algorithm
 {
 
 
-void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -54,5 +57,98 @@ void SORT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void SORT::runOpenMPVariantBase(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( tune_idx ) {
+
+    case 0 : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        sampleSortOpenMP(SORT_SCRATCH_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case 1 : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        mergeSortOpenMP(SORT_SCRATCH_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case 2 : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        radixSortOpenMP(SORT_SCRATCH_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid
+                << " tuning = " << tune_idx << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void SORT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if (vid == Base_OpenMP) {
+
+    runOpenMPVariantBase(vid, tune_idx);
+
+  } else {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void SORT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+    // same order as tunings in runOpenMPVariantBase
+    addVariantTuningName(vid, "sample");
+    addVariantTuningName(vid, "merge");
+    addVariantTuningName(vid, "radix");
+  } else {
+    // RAJA sorts split work across threads themselves, so schedule
+    // tunings would not change these loops
+    addVariantTuningName(vid, getDefaultTuningName());
+  }
+}
+#endif
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -64,5 +66,70 @@ void SORT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void SORT::runSeqVariantRadix(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        radixSortSeq(SORT_SCRATCH_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantRadix(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void SORT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  if (vid == Base_Seq) {
+    addVariantTuningName(vid, "radix");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
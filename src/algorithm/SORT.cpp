@@ -36,6 +36,7 @@ SORT::SORT(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
@@ -47,9 +48,13 @@ SORT::~SORT()
 {
 }
 
-void SORT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORT::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+  m_tmp = nullptr;
+  if ( usesScratch(vid, tune_idx) ) {
+    allocData(m_tmp, getActualProblemSize(), vid);
+  }
 }
 
 void SORT::updateChecksum(VariantID vid, size_t tune_idx)
@@ -57,10 +62,16 @@ void SORT::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize()*getRunReps());
 }
 
+void SORT::resetData(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  initDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+}
+
 void SORT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
   deallocData(m_x, vid);
+  deallocData(m_tmp, vid);
 }
 
 } // end namespace algorithm
@@ -16,7 +16,7 @@
 #define RAJAPerf_Algorithm_SORT_HPP
 
 #define SORT_DATA_SETUP \
-  Real_ptr x = m_x;
+  Real_ptr x = m_x + getActualProblemSize()*getRunRepOffset();
 
 #define STD_SORT_ARGS  \
   x + iend*irep + ibegin, x + iend*irep + iend
@@ -24,6 +24,9 @@
 #define RAJA_SORT_ARGS \
   RAJA::make_span(x + iend*irep + ibegin, iend - ibegin)
 
+#define SORT_SCRATCH_ARGS \
+  x + iend*irep + ibegin, m_tmp, iend - ibegin
+
 
 #include "common/KernelBase.hpp"
 
@@ -45,9 +48,18 @@ public:
   void setUp(VariantID vid, size_t tune_idx);
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
+  void resetData(VariantID vid, size_t tune_idx);
 
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantRadix(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, size_t tune_idx);
+
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -58,7 +70,12 @@ public:
 private:
   static const size_t default_gpu_block_size = 0;
 
+  // whether tuning sorts with scratch space
+  bool usesScratch(VariantID vid, size_t tune_idx) const
+  { return vid == Base_OpenMP || (vid == Base_Seq && tune_idx > 0); }
+
   Real_ptr m_x;
+  Real_ptr m_tmp;
 };
 
 } // end namespace algorithm
@@ -22,12 +22,14 @@ namespace algorithm
 {
 
 #define SORTPAIRS_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, iend*run_reps); \
-  allocAndInitCudaDeviceData(i, m_i, iend*run_reps);
+  Real_ptr x_host = x; \
+  Real_ptr i_host = i; \
+  allocAndInitCudaDeviceData(x, x_host, iend*run_reps); \
+  allocAndInitCudaDeviceData(i, i_host, iend*run_reps);
 
 #define SORTPAIRS_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_x, x, iend*run_reps); \
-  getCudaDeviceData(m_i, i, iend*run_reps); \
+  getCudaDeviceData(x_host, x, iend*run_reps); \
+  getCudaDeviceData(i_host, i, iend*run_reps); \
   deallocCudaDeviceData(x); \
   deallocCudaDeviceData(i);
 
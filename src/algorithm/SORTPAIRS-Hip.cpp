@@ -22,12 +22,14 @@ namespace algorithm
 {
 
 #define SORTPAIRS_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, iend*run_reps); \
-  allocAndInitHipDeviceData(i, m_i, iend*run_reps);
+  Real_ptr x_host = x; \
+  Real_ptr i_host = i; \
+  allocAndInitHipDeviceData(x, x_host, iend*run_reps); \
+  allocAndInitHipDeviceData(i, i_host, iend*run_reps);
 
 #define SORTPAIRS_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_x, x, iend*run_reps); \
-  getHipDeviceData(m_i, i, iend*run_reps); \
+  getHipDeviceData(x_host, x, iend*run_reps); \
+  getHipDeviceData(i_host, i, iend*run_reps); \
   deallocHipDeviceData(x); \
   deallocHipDeviceData(i);
 
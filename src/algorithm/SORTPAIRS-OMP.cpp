@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -54,5 +56,70 @@ void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void SORTPAIRS::runOpenMPVariantBase(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( tune_idx ) {
+
+    case 0 : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        radixSortPairsOpenMP(SORTPAIRS_SCRATCH_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid
+                << " tuning = " << tune_idx << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+void SORTPAIRS::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if (vid == Base_OpenMP) {
+
+    runOpenMPVariantBase(vid, tune_idx);
+
+  } else {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void SORTPAIRS::setOpenMPTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_OpenMP) {
+    // same order as tunings in runOpenMPVariantBase
+    addVariantTuningName(vid, "radix");
+  } else {
+    // RAJA sorts split work across threads themselves, so schedule
+    // tunings would not change these loops
+    addVariantTuningName(vid, getDefaultTuningName());
+  }
+}
+#endif
+
 } // end namespace algorithm
 } // end namespace rajaperf
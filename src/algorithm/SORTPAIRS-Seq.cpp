@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "SortUtils.hpp"
+
 #include <algorithm>
 #include <vector>
 #include <utility>
@@ -21,7 +23,7 @@ namespace algorithm
 {
 
 
-void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -31,7 +33,40 @@ void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
   switch ( vid ) {
 
-    case Base_Seq : {
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::sort_pairs<RAJA::loop_exec>(RAJA_SORTPAIRS_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SORTPAIRS::runSeqVariantBase(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( tune_idx ) {
+
+    case 0 : {
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -61,28 +96,67 @@ void SORTPAIRS::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
       break;
     }
-#if defined(RUN_RAJA_SEQ)
-    case RAJA_Seq : {
+
+    case 1 : {
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::sort_pairs<RAJA::loop_exec>(RAJA_SORTPAIRS_ARGS);
+        sortPairsZip(SORTPAIRS_ZIP_ARGS);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case 2 : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        sortPairsGather(SORTPAIRS_GATHER_ARGS);
 
       }
       stopTimer();
 
       break;
     }
-#endif
 
     default : {
-      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid
+                << " tuning = " << tune_idx << std::endl;
     }
 
   }
 
 }
 
+void SORTPAIRS::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if (vid == Base_Seq) {
+
+    runSeqVariantBase(vid, tune_idx);
+
+  } else {
+
+    runSeqVariantDefault(vid);
+
+  }
+}
+
+void SORTPAIRS::setSeqTuningDefinitions(VariantID vid)
+{
+  if (vid == Base_Seq) {
+    // same order as tunings in runSeqVariantBase; default sorts an array
+    // of key-value structs, zip sorts keys and values in place
+    addVariantTuningName(vid, "default");
+    addVariantTuningName(vid, "zip");
+    addVariantTuningName(vid, "gather");
+  } else {
+    addVariantTuningName(vid, "default");
+  }
+}
+
 } // end namespace algorithm
 } // end namespace rajaperf
@@ -36,6 +36,7 @@ SORTPAIRS::SORTPAIRS(const RunParams& params)
   setVariantDefined( Base_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( RAJA_CUDA );
@@ -47,10 +48,20 @@ SORTPAIRS::~SORTPAIRS()
 {
 }
 
-void SORTPAIRS::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void SORTPAIRS::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
   allocAndInitDataRandValue(m_i, getActualProblemSize()*getRunReps(), vid);
+  m_x_tmp = nullptr;
+  m_i_tmp = nullptr;
+  if ( usesScratch(vid, tune_idx) ) {
+    allocData(m_x_tmp, getActualProblemSize(), vid);
+    allocData(m_i_tmp, getActualProblemSize(), vid);
+  }
+  m_idx = nullptr;
+  if ( usesIndices(vid, tune_idx) ) {
+    allocData(m_idx, getActualProblemSize(), vid);
+  }
 }
 
 void SORTPAIRS::updateChecksum(VariantID vid, size_t tune_idx)
@@ -59,11 +70,20 @@ void SORTPAIRS::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += calcChecksum(m_i, getActualProblemSize()*getRunReps());
 }
 
+void SORTPAIRS::resetData(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  initDataRandValue(m_x, getActualProblemSize()*getRunReps(), vid);
+  initDataRandValue(m_i, getActualProblemSize()*getRunReps(), vid);
+}
+
 void SORTPAIRS::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
   deallocData(m_x, vid);
   deallocData(m_i, vid);
+  deallocData(m_x_tmp, vid);
+  deallocData(m_i_tmp, vid);
+  deallocData(m_idx, vid);
 }
 
 } // end namespace algorithm
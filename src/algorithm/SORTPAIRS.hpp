@@ -16,13 +16,24 @@
 #define RAJAPerf_Algorithm_SORTPAIRS_HPP
 
 #define SORTPAIRS_DATA_SETUP \
-  Real_ptr x = m_x;          \
-  Real_ptr i = m_i;
+  Real_ptr x = m_x + getActualProblemSize()*getRunRepOffset(); \
+  Real_ptr i = m_i + getActualProblemSize()*getRunRepOffset();
 
 #define RAJA_SORTPAIRS_ARGS  \
   RAJA::make_span(x + iend*irep + ibegin, iend - ibegin), \
   RAJA::make_span(i + iend*irep + ibegin, iend - ibegin)
 
+#define SORTPAIRS_ZIP_ARGS \
+  x + iend*irep + ibegin, i + iend*irep + ibegin, iend - ibegin
+
+#define SORTPAIRS_GATHER_ARGS \
+  x + iend*irep + ibegin, i + iend*irep + ibegin, m_idx, \
+  m_x_tmp, m_i_tmp, iend - ibegin
+
+#define SORTPAIRS_SCRATCH_ARGS \
+  x + iend*irep + ibegin, i + iend*irep + ibegin, \
+  m_x_tmp, m_i_tmp, iend - ibegin
+
 
 #include "common/KernelBase.hpp"
 
@@ -44,9 +55,18 @@ public:
   void setUp(VariantID vid, size_t tune_idx);
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
+  void resetData(VariantID vid, size_t tune_idx);
 
   void runSeqVariant(VariantID vid, size_t tune_idx);
   void runOpenMPVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantBase(VariantID vid, size_t tune_idx);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBase(VariantID vid, size_t tune_idx);
+
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -57,8 +77,18 @@ public:
 private:
   static const size_t default_gpu_block_size = 0;
 
+  // whether tuning sorts with scratch space
+  bool usesScratch(VariantID vid, size_t tune_idx) const
+  { return vid == Base_OpenMP || (vid == Base_Seq && tune_idx == 2); }
+  // whether tuning sorts indices of keys
+  bool usesIndices(VariantID vid, size_t tune_idx) const
+  { return vid == Base_Seq && tune_idx == 2; }
+
   Real_ptr m_x;
   Real_ptr m_i;
+  Real_ptr m_x_tmp;
+  Real_ptr m_i_tmp;
+  Index_ptr m_idx;
 };
 
 } // end namespace algorithm
@@ -0,0 +1,581 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Sort algorithms used by algorithm kernel variants: an LSD radix sort of
+/// floating point keys, sorts of key-value pairs held in separate arrays,
+/// and with OpenMP a parallel radix sort (of keys or key-value pairs), a
+/// sample sort, and a merge sort of thread-local runs.
+///
+
+#ifndef RAJAPerf_Algorithm_SortUtils_HPP
+#define RAJAPerf_Algorithm_SortUtils_HPP
+
+#include "rajaperf_config.hpp"
+#include "common/RPTypes.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+namespace detail
+{
+
+//
+// Radix sorts sort keys 8 bits at a time.
+//
+constexpr int radix_bits = 8;
+constexpr Index_type radix_size = Index_type(1) << radix_bits;
+
+//
+// Map floating point keys to unsigned integers of the same size that sort
+// in the same order: flip the sign bit of positive keys and all bits of
+// negative keys. NaNs are not ordered.
+//
+template < typename Key >
+struct RadixTraits
+{
+  static_assert(std::is_floating_point<Key>::value,
+                "radix sorts only sort floating point keys");
+
+  using bits_type = typename std::conditional<sizeof(Key) == 8,
+                                              uint64_t, uint32_t>::type;
+
+  static constexpr int num_passes = 8*sizeof(Key) / radix_bits;
+
+  static bits_type toBits(Key key)
+  {
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(Key));
+    const bits_type sign = bits_type(1) << (8*sizeof(Key) - 1);
+    return (bits & sign) ? ~bits : (bits | sign);
+  }
+
+  static Index_type digit(Key key, int pass)
+  {
+    return static_cast<Index_type>(
+        (toBits(key) >> (pass*radix_bits)) & (radix_size - 1));
+  }
+};
+
+/*!
+ * \brief Return number of keys in [0, n) taken from a in the first k keys
+ *        of the stable merge of sorted ranges a (na keys) and b (nb keys).
+ */
+template < typename Key >
+Index_type mergePathSplit(const Key* a, Index_type na,
+                          const Key* b, Index_type nb,
+                          Index_type k)
+{
+  Index_type lo = std::max(Index_type(0), k - nb);
+  Index_type hi = std::min(k, na);
+  while ( lo < hi ) {
+    Index_type i = lo + (hi - lo) / 2;
+    if ( !(b[k - i - 1] < a[i]) ) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief Key-value pair copied out of a ZipIterator.
+ */
+template < typename Key, typename Val >
+struct ZipValue
+{
+  Key key;
+  Val val;
+};
+
+/*!
+ * \brief Reference to a key and its value in separate arrays; assigning
+ *        to it assigns both.
+ */
+template < typename Key, typename Val >
+struct ZipRef
+{
+  Key& key;
+  Val& val;
+
+  ZipRef(Key& k, Val& v) : key(k), val(v) { }
+  ZipRef(const ZipRef&) = default;
+
+  operator ZipValue<Key, Val>() const { return {key, val}; }
+
+  ZipRef& operator=(const ZipRef& rhs)
+  { key = rhs.key; val = rhs.val; return *this; }
+  ZipRef& operator=(const ZipValue<Key, Val>& rhs)
+  { key = rhs.key; val = rhs.val; return *this; }
+
+  friend void swap(ZipRef lhs, ZipRef rhs)
+  {
+    std::swap(lhs.key, rhs.key);
+    std::swap(lhs.val, rhs.val);
+  }
+};
+
+/*!
+ * \brief Random access iterator over keys and values in separate arrays,
+ *        so standard algorithms can sort them in place.
+ */
+template < typename Key, typename Val >
+class ZipIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = ZipValue<Key, Val>;
+  using difference_type = std::ptrdiff_t;
+  using reference = ZipRef<Key, Val>;
+  using pointer = void;
+
+  ZipIterator(Key* keys, Val* vals) : m_keys(keys), m_vals(vals) { }
+
+  reference operator*() const { return reference(*m_keys, *m_vals); }
+  reference operator[](difference_type d) const
+  { return reference(m_keys[d], m_vals[d]); }
+
+  ZipIterator& operator++() { ++m_keys; ++m_vals; return *this; }
+  ZipIterator& operator--() { --m_keys; --m_vals; return *this; }
+  ZipIterator operator++(int) { ZipIterator it(*this); ++*this; return it; }
+  ZipIterator operator--(int) { ZipIterator it(*this); --*this; return it; }
+
+  ZipIterator& operator+=(difference_type d)
+  { m_keys += d; m_vals += d; return *this; }
+  ZipIterator& operator-=(difference_type d)
+  { m_keys -= d; m_vals -= d; return *this; }
+
+  friend ZipIterator operator+(ZipIterator it, difference_type d)
+  { return it += d; }
+  friend ZipIterator operator+(difference_type d, ZipIterator it)
+  { return it += d; }
+  friend ZipIterator operator-(ZipIterator it, difference_type d)
+  { return it -= d; }
+  friend difference_type operator-(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys - rhs.m_keys; }
+
+  friend bool operator==(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys == rhs.m_keys; }
+  friend bool operator!=(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys != rhs.m_keys; }
+  friend bool operator<(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys < rhs.m_keys; }
+  friend bool operator>(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys > rhs.m_keys; }
+  friend bool operator<=(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys <= rhs.m_keys; }
+  friend bool operator>=(const ZipIterator& lhs, const ZipIterator& rhs)
+  { return lhs.m_keys >= rhs.m_keys; }
+
+private:
+  Key* m_keys;
+  Val* m_vals;
+};
+
+//
+// Values moved by radix sorts to follow their keys; NoRadixValues when
+// sorting keys alone.
+//
+struct NoRadixValues
+{
+  void move(Index_type, Index_type) const { }
+  void swap() { }
+  void copyBack(Index_type, Index_type) const { }
+};
+
+template < typename Val >
+struct RadixValues
+{
+  Val* vals;
+  Val* src;
+  Val* dst;
+
+  RadixValues(Val* v, Val* tmp) : vals(v), src(v), dst(tmp) { }
+
+  void move(Index_type from, Index_type to) const { dst[to] = src[from]; }
+  void swap() { std::swap(src, dst); }
+  void copyBack(Index_type ibegin, Index_type iend) const
+  {
+    if ( src != vals ) {
+      std::copy(src + ibegin, src + iend, vals + ibegin);
+    }
+  }
+};
+
+} // closing brace for detail namespace
+
+
+/*!
+ * \brief Sort n keys with an LSD radix sort, using tmp (n keys) as scratch.
+ *
+ * Digit counts for all passes are taken in one read of the keys, and
+ * passes in which all keys have the same digit are skipped.
+ */
+template < typename Key >
+void radixSortSeq(Key* keys, Key* tmp, Index_type n)
+{
+  using traits = detail::RadixTraits<Key>;
+  constexpr Index_type radix_size = detail::radix_size;
+
+  std::vector<Index_type> counts(traits::num_passes*radix_size, 0);
+  for (Index_type i = 0; i < n; ++i) {
+    for (int p = 0; p < traits::num_passes; ++p) {
+      ++counts[p*radix_size + traits::digit(keys[i], p)];
+    }
+  }
+
+  Key* src = keys;
+  Key* dst = tmp;
+  for (int p = 0; p < traits::num_passes; ++p) {
+
+    Index_type* offsets = &counts[p*radix_size];
+    if ( std::find(offsets, offsets + radix_size, n) != offsets + radix_size ) {
+      continue;
+    }
+
+    Index_type offset = 0;
+    for (Index_type d = 0; d < radix_size; ++d) {
+      Index_type count = offsets[d];
+      offsets[d] = offset;
+      offset += count;
+    }
+
+    for (Index_type i = 0; i < n; ++i) {
+      dst[offsets[traits::digit(src[i], p)]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+
+  if ( src != keys ) {
+    std::copy(src, src + n, keys);
+  }
+}
+
+/*!
+ * \brief Sort n keys and their values, held in separate arrays, by key by
+ *        sorting them in place through a ZipIterator.
+ */
+template < typename Key, typename Val >
+void sortPairsZip(Key* keys, Val* vals, Index_type n)
+{
+  detail::ZipIterator<Key, Val> begin(keys, vals);
+  std::sort(begin, begin + n,
+      [](const auto& lhs, const auto& rhs) { return lhs.key < rhs.key; });
+}
+
+/*!
+ * \brief Sort n keys and their values, held in separate arrays, by key by
+ *        sorting indices of the keys, then gathering keys and values in
+ *        that order, using idx (n indices), keys_tmp and vals_tmp (n keys
+ *        and values) as scratch.
+ */
+template < typename Key, typename Val >
+void sortPairsGather(Key* keys, Val* vals, Index_type* idx,
+                     Key* keys_tmp, Val* vals_tmp, Index_type n)
+{
+  for (Index_type j = 0; j < n; ++j) {
+    idx[j] = j;
+  }
+  std::sort(idx, idx + n,
+      [=](Index_type lhs, Index_type rhs) { return keys[lhs] < keys[rhs]; });
+
+  for (Index_type j = 0; j < n; ++j) {
+    keys_tmp[j] = keys[idx[j]];
+    vals_tmp[j] = vals[idx[j]];
+  }
+  std::copy(keys_tmp, keys_tmp + n, keys);
+  std::copy(vals_tmp, vals_tmp + n, vals);
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+namespace detail
+{
+
+/*!
+ * \brief Sort n keys with a parallel LSD radix sort, using tmp (n keys) as
+ *        scratch, moving values along with their keys.
+ *
+ * In each pass, each thread counts digits in its chunk of the keys, then
+ * scatters them to offsets ordered by digit then thread, so the sort is
+ * stable. Passes in which all keys have the same digit are skipped.
+ */
+template < typename Key, typename Values >
+void radixSortOpenMP(Key* keys, Key* tmp, Values& values, Index_type n)
+{
+  using traits = detail::RadixTraits<Key>;
+  constexpr Index_type radix_size = detail::radix_size;
+
+  // count of each digit in chunk of each thread, then offset of its next
+  // key with that digit
+  std::vector<Index_type> counts(omp_get_max_threads()*radix_size);
+
+  Key* src = keys;
+  Key* dst = tmp;
+  bool skip_pass = false;
+
+  #pragma omp parallel
+  {
+    const Index_type nt = omp_get_num_threads();
+    const Index_type t = omp_get_thread_num();
+    const Index_type ibegin = n * t / nt;
+    const Index_type iend = n * (t+1) / nt;
+    Index_type* my_counts = &counts[t*radix_size];
+
+    for (int p = 0; p < traits::num_passes; ++p) {
+
+      std::fill(my_counts, my_counts + radix_size, 0);
+      for (Index_type i = ibegin; i < iend; ++i) {
+        ++my_counts[traits::digit(src[i], p)];
+      }
+
+      #pragma omp barrier
+
+      #pragma omp single
+      {
+        skip_pass = false;
+        Index_type offset = 0;
+        for (Index_type d = 0; d < radix_size; ++d) {
+          Index_type digit_count = 0;
+          for (Index_type tt = 0; tt < nt; ++tt) {
+            Index_type count = counts[tt*radix_size + d];
+            counts[tt*radix_size + d] = offset;
+            offset += count;
+            digit_count += count;
+          }
+          skip_pass = skip_pass || (digit_count == n);
+        }
+      }
+
+      if ( !skip_pass ) {
+
+        for (Index_type i = ibegin; i < iend; ++i) {
+          const Index_type pos = my_counts[traits::digit(src[i], p)]++;
+          dst[pos] = src[i];
+          values.move(i, pos);
+        }
+
+        #pragma omp barrier
+
+        #pragma omp single
+        {
+          std::swap(src, dst);
+          values.swap();
+        }
+
+      }
+    }
+
+    if ( src != keys ) {
+      std::copy(src + ibegin, src + iend, keys + ibegin);
+    }
+    values.copyBack(ibegin, iend);
+  }
+}
+
+} // closing brace for detail namespace
+
+/*!
+ * \brief Sort n keys with a parallel LSD radix sort, using tmp (n keys) as
+ *        scratch.
+ */
+template < typename Key >
+void radixSortOpenMP(Key* keys, Key* tmp, Index_type n)
+{
+  detail::NoRadixValues values;
+  detail::radixSortOpenMP(keys, tmp, values, n);
+}
+
+/*!
+ * \brief Sort n keys and their values, held in separate arrays, by key with
+ *        a parallel LSD radix sort, using keys_tmp and vals_tmp (n keys and
+ *        values) as scratch.
+ */
+template < typename Key, typename Val >
+void radixSortPairsOpenMP(Key* keys, Val* vals,
+                          Key* keys_tmp, Val* vals_tmp, Index_type n)
+{
+  detail::RadixValues<Val> values(vals, vals_tmp);
+  detail::radixSortOpenMP(keys, keys_tmp, values, n);
+}
+
+//
+// Number of samples taken for each bucket when choosing sample sort
+// splitters; more samples give more even buckets.
+//
+constexpr Index_type sample_sort_oversampling = 64;
+
+/*!
+ * \brief Sort n keys with a parallel sample sort, using tmp (n keys) as
+ *        scratch.
+ *
+ * Splitters chosen from a sorted sample of the keys divide them into one
+ * bucket per thread. Threads scatter keys from their chunks to the
+ * buckets, then each thread sorts one bucket and copies it back.
+ */
+template < typename Key >
+void sampleSortOpenMP(Key* keys, Key* tmp, Index_type n)
+{
+  if ( n < 2 ) {
+    return;
+  }
+
+  const Index_type max_threads = omp_get_max_threads();
+
+  std::vector<Key> splitters;
+  // count of keys in each bucket in chunk of each thread, then offset of
+  // its next key in that bucket
+  std::vector<Index_type> counts(max_threads*max_threads);
+  std::vector<Index_type> bucket_begin(max_threads+1);
+
+  #pragma omp parallel
+  {
+    const Index_type nt = omp_get_num_threads();
+    const Index_type t = omp_get_thread_num();
+    const Index_type ibegin = n * t / nt;
+    const Index_type iend = n * (t+1) / nt;
+    Index_type* my_counts = &counts[t*nt];
+
+    #pragma omp single
+    {
+      const Index_type num_samples = std::min(n, nt*sample_sort_oversampling);
+      std::vector<Key> samples(num_samples);
+      for (Index_type s = 0; s < num_samples; ++s) {
+        samples[s] = keys[s * n / num_samples];
+      }
+      std::sort(samples.begin(), samples.end());
+
+      splitters.resize(nt-1);
+      for (Index_type b = 1; b < nt; ++b) {
+        splitters[b-1] = samples[b * num_samples / nt];
+      }
+    }
+
+    auto bucket = [&](const Key& key) {
+      return std::upper_bound(splitters.begin(), splitters.end(), key) -
+             splitters.begin();
+    };
+
+    std::fill(my_counts, my_counts + nt, 0);
+    for (Index_type i = ibegin; i < iend; ++i) {
+      ++my_counts[bucket(keys[i])];
+    }
+
+    #pragma omp barrier
+
+    #pragma omp single
+    {
+      Index_type offset = 0;
+      for (Index_type b = 0; b < nt; ++b) {
+        bucket_begin[b] = offset;
+        for (Index_type tt = 0; tt < nt; ++tt) {
+          Index_type count = counts[tt*nt + b];
+          counts[tt*nt + b] = offset;
+          offset += count;
+        }
+      }
+      bucket_begin[nt] = offset;
+    }
+
+    for (Index_type i = ibegin; i < iend; ++i) {
+      tmp[my_counts[bucket(keys[i])]++] = keys[i];
+    }
+
+    #pragma omp barrier
+
+    std::sort(tmp + bucket_begin[t], tmp + bucket_begin[t+1]);
+    std::copy(tmp + bucket_begin[t], tmp + bucket_begin[t+1],
+              keys + bucket_begin[t]);
+  }
+}
+
+/*!
+ * \brief Sort n keys with a parallel merge sort, using tmp (n keys) as
+ *        scratch.
+ *
+ * Each thread sorts a run of the keys, then pairs of runs are merged until
+ * one run is left. In each round of merges, each thread writes an equal
+ * part of the output, found by splitting merges along their merge paths.
+ */
+template < typename Key >
+void mergeSortOpenMP(Key* keys, Key* tmp, Index_type n)
+{
+  #pragma omp parallel
+  {
+    const Index_type nt = omp_get_num_threads();
+    const Index_type t = omp_get_thread_num();
+    const Index_type obegin = n * t / nt;
+    const Index_type oend = n * (t+1) / nt;
+
+    auto run_begin = [&](Index_type r) { return n * std::min(r, nt) / nt; };
+
+    std::sort(keys + obegin, keys + oend);
+
+    #pragma omp barrier
+
+    Key* src = keys;
+    Key* dst = tmp;
+    for (Index_type width = 1; width < nt; width *= 2) {
+
+      for (Index_type r = 0; r < nt; r += 2*width) {
+
+        const Index_type a_begin = run_begin(r);
+        const Index_type b_begin = run_begin(r + width);
+        const Index_type b_end = run_begin(r + 2*width);
+
+        const Index_type lo = std::max(a_begin, obegin);
+        const Index_type hi = std::min(b_end, oend);
+        if ( lo >= hi ) {
+          continue;
+        }
+
+        const Key* a = src + a_begin;
+        const Key* b = src + b_begin;
+        const Index_type na = b_begin - a_begin;
+        const Index_type nb = b_end - b_begin;
+        const Index_type ia_lo = detail::mergePathSplit(a, na, b, nb, lo - a_begin);
+        const Index_type ia_hi = detail::mergePathSplit(a, na, b, nb, hi - a_begin);
+        const Index_type ib_lo = (lo - a_begin) - ia_lo;
+        const Index_type ib_hi = (hi - a_begin) - ia_hi;
+
+        std::merge(a + ia_lo, a + ia_hi, b + ib_lo, b + ib_hi, dst + lo);
+      }
+      std::swap(src, dst);
+
+      #pragma omp barrier
+    }
+
+    if ( src != keys ) {
+      std::copy(src + obegin, src + oend, keys + obegin);
+    }
+  }
+}
+
+#endif
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
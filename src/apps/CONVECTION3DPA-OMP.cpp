@@ -15,7 +15,8 @@
 namespace rajaperf {
 namespace apps {
 
-void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename OMP_EXEC_POL >
+void CONVECTION3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -29,100 +30,101 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#pragma omp parallel for
-      for (int e = 0; e < NE; ++e) {
+      RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+        for (int e = 0; e < NE; ++e) {
 
-        CONVECTION3DPA_0_CPU;
+          CONVECTION3DPA_0_CPU;
 
-        CPU_FOREACH(dz,z,CPA_D1D)
-        {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dz,z,CPA_D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dy,y,CPA_D1D)
             {
-              CONVECTION3DPA_1;
+              CPU_FOREACH(dx,x,CPA_D1D)
+              {
+                CONVECTION3DPA_1;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
-        {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dz,z,CPA_D1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(dy,y,CPA_D1D)
             {
-              CONVECTION3DPA_2;
+              CPU_FOREACH(qx,x,CPA_Q1D)
+              {
+                CONVECTION3DPA_2;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
-        {
-          CPU_FOREACH(qx,x,CPA_Q1D)
+          CPU_FOREACH(dz,z,CPA_D1D)
           {
-            CPU_FOREACH(qy,y,CPA_Q1D)
+            CPU_FOREACH(qx,x,CPA_Q1D)
             {
-              CONVECTION3DPA_3;
+              CPU_FOREACH(qy,y,CPA_Q1D)
+              {
+                CONVECTION3DPA_3;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
-        {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qx,x,CPA_Q1D)
           {
-            CPU_FOREACH(qz,z,CPA_Q1D)
+            CPU_FOREACH(qy,y,CPA_Q1D)
             {
-              CONVECTION3DPA_4;
+              CPU_FOREACH(qz,z,CPA_Q1D)
+              {
+                CONVECTION3DPA_4;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(qz,z,CPA_Q1D)
-        {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qz,z,CPA_Q1D)
           {
-            CPU_FOREACH(qx,x,CPA_Q1D)
+            CPU_FOREACH(qy,y,CPA_Q1D)
             {
-              CONVECTION3DPA_5;
+              CPU_FOREACH(qx,x,CPA_Q1D)
+              {
+                CONVECTION3DPA_5;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(qx,x,CPA_Q1D)
-        {
-          CPU_FOREACH(qy,y,CPA_Q1D)
+          CPU_FOREACH(qx,x,CPA_Q1D)
           {
-            CPU_FOREACH(dz,z,CPA_D1D)
+            CPU_FOREACH(qy,y,CPA_Q1D)
             {
-              CONVECTION3DPA_6;
+              CPU_FOREACH(dz,z,CPA_D1D)
+              {
+                CONVECTION3DPA_6;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
-        {
-           CPU_FOREACH(qx,x,CPA_Q1D)
-           {
-              CPU_FOREACH(dy,y,CPA_D1D)
-              {
-                CONVECTION3DPA_7;
-             }
+          CPU_FOREACH(dz,z,CPA_D1D)
+          {
+             CPU_FOREACH(qx,x,CPA_Q1D)
+             {
+                CPU_FOREACH(dy,y,CPA_D1D)
+                {
+                  CONVECTION3DPA_7;
+               }
+            }
           }
-        }
 
-        CPU_FOREACH(dz,z,CPA_D1D)
-        {
-          CPU_FOREACH(dy,y,CPA_D1D)
+          CPU_FOREACH(dz,z,CPA_D1D)
           {
-            CPU_FOREACH(dx,x,CPA_D1D)
+            CPU_FOREACH(dy,y,CPA_D1D)
             {
-              CONVECTION3DPA_8;
+              CPU_FOREACH(dx,x,CPA_D1D)
+              {
+                CONVECTION3DPA_8;
+              }
             }
           }
-        }
 
-      } // element loop
+        } // element loop
+      )
     }
     stopTimer();
 
@@ -317,5 +319,23 @@ void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void CONVECTION3DPA::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -22,7 +22,8 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void DEL_DOT_VEC_2D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -44,11 +45,12 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          DEL_DOT_VEC_2D_BODY_INDEX;
-          DEL_DOT_VEC_2D_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            DEL_DOT_VEC_2D_BODY_INDEX;
+            DEL_DOT_VEC_2D_BODY;
+          }
+        )
 
       }
       stopTimer();
@@ -66,10 +68,11 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          deldotvec2d_base_lam(ii);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            deldotvec2d_base_lam(ii);
+          }
+        )
 
       }
       stopTimer();
@@ -91,7 +94,7 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(zones, deldotvec2d_lam);
+        RAJA::forall<OMP_EXEC_POL>(zones, deldotvec2d_lam);
 
       }
       stopTimer();
@@ -110,5 +113,23 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -120,6 +120,8 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
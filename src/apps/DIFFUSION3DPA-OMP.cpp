@@ -18,7 +18,8 @@
 namespace rajaperf {
 namespace apps {
 
-void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename OMP_EXEC_POL >
+void DIFFUSION3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -32,80 +33,81 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#pragma omp parallel for
-      for (int e = 0; e < NE; ++e) {
+      RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+        for (int e = 0; e < NE; ++e) {
 
-        DIFFUSION3DPA_0_CPU;
+          DIFFUSION3DPA_0_CPU;
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
-              DIFFUSION3DPA_1;
+          CPU_FOREACH(dz, z, DPA_D1D) {
+            CPU_FOREACH(dy, y, DPA_D1D) {
+              CPU_FOREACH(dx, x, DPA_D1D) {
+                DIFFUSION3DPA_1;
+              }
             }
           }
-        }
-
-        CPU_FOREACH(dy, y, DPA_D1D) {
-          CPU_FOREACH(qx, x, DPA_Q1D) {
-            DIFFUSION3DPA_2;
-          }
-        }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
           CPU_FOREACH(dy, y, DPA_D1D) {
             CPU_FOREACH(qx, x, DPA_Q1D) {
-              DIFFUSION3DPA_3;
+              DIFFUSION3DPA_2;
             }
           }
-        }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
-              DIFFUSION3DPA_4;
+          CPU_FOREACH(dz, z, DPA_D1D) {
+            CPU_FOREACH(dy, y, DPA_D1D) {
+              CPU_FOREACH(qx, x, DPA_Q1D) {
+                DIFFUSION3DPA_3;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(qx, x, DPA_Q1D) {
-              DIFFUSION3DPA_5;
+          CPU_FOREACH(dz, z, DPA_D1D) {
+            CPU_FOREACH(qy, y, DPA_Q1D) {
+              CPU_FOREACH(qx, x, DPA_Q1D) {
+                DIFFUSION3DPA_4;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(d, y, DPA_D1D) {
-          CPU_FOREACH(q, x, DPA_Q1D) {
-            DIFFUSION3DPA_6;
+          CPU_FOREACH(qz, z, DPA_Q1D) {
+            CPU_FOREACH(qy, y, DPA_Q1D) {
+              CPU_FOREACH(qx, x, DPA_Q1D) {
+                DIFFUSION3DPA_5;
+              }
+            }
           }
-        }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(qy, y, DPA_Q1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
-              DIFFUSION3DPA_7;
+          CPU_FOREACH(d, y, DPA_D1D) {
+            CPU_FOREACH(q, x, DPA_Q1D) {
+              DIFFUSION3DPA_6;
             }
           }
-        }
 
-        CPU_FOREACH(qz, z, DPA_Q1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
-              DIFFUSION3DPA_8;
+          CPU_FOREACH(qz, z, DPA_Q1D) {
+            CPU_FOREACH(qy, y, DPA_Q1D) {
+              CPU_FOREACH(dx, x, DPA_D1D) {
+                DIFFUSION3DPA_7;
+              }
             }
           }
-        }
 
-        CPU_FOREACH(dz, z, DPA_D1D) {
-          CPU_FOREACH(dy, y, DPA_D1D) {
-            CPU_FOREACH(dx, x, DPA_D1D) {
-              DIFFUSION3DPA_9;
+          CPU_FOREACH(qz, z, DPA_Q1D) {
+            CPU_FOREACH(dy, y, DPA_D1D) {
+              CPU_FOREACH(dx, x, DPA_D1D) {
+                DIFFUSION3DPA_8;
+              }
+            }
+          }
+
+          CPU_FOREACH(dz, z, DPA_D1D) {
+            CPU_FOREACH(dy, y, DPA_D1D) {
+              CPU_FOREACH(dx, x, DPA_D1D) {
+                DIFFUSION3DPA_9;
+              }
             }
           }
-        }
 
-      } // element loop
+        } // element loop
+      )
     }
     stopTimer();
 
@@ -319,5 +321,23 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void DIFFUSION3DPA::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
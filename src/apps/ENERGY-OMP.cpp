@@ -182,5 +182,12 @@ void ENERGY::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+void ENERGY::setOpenMPTuningDefinitions(VariantID vid)
+{
+  // loops run in one parallel region with static schedules and no waits
+  // between them, so they can't take schedule tunings
+  addVariantTuningName(vid, getDefaultTuningName());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace apps
 {
 
 
-void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void FIR::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -45,10 +46,11 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-           FIR_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = ibegin; i < iend; ++i ) {
+             FIR_BODY;
+          }
+        )
 
       }
       stopTimer();
@@ -61,10 +63,11 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-           fir_lam(i);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = ibegin; i < iend; ++i ) {
+             fir_lam(i);
+          }
+        )
 
       }
       stopTimer();
@@ -77,7 +80,7 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend), fir_lam);
 
       }
@@ -97,5 +100,23 @@ void FIR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void FIR::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
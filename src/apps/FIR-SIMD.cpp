@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "FIR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < size_t width, size_t unroll >
+void FIR::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_COEFF;
+
+  FIR_DATA_SETUP;
+
+  Real_type coeff[FIR_COEFFLEN];
+  std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    pack vcoeff[FIR_COEFFLEN];
+    for (Index_type j = 0; j < coefflen; ++j ) {
+      vcoeff[j] = pack(coeff[j]);
+    }
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t) {
+          pack sum(0.0);
+          for (Index_type j = 0; j < coefflen; ++j ) {
+            sum = sum + vcoeff[j] * pack::load(&in[i+j]);
+          }
+          sum.store(&out[i]);
+        },
+        [&](Index_type i) {
+          FIR_BODY;
+        });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIR : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(FIR)
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
@@ -18,7 +18,8 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void HALOEXCHANGE::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -39,10 +40,11 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
           Index_type  len  = pack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
-              HALOEXCHANGE_PACK_BODY;
-            }
+            RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+              for (Index_type i = 0; i < len; i++) {
+                HALOEXCHANGE_PACK_BODY;
+              }
+            )
             buffer += len;
           }
         }
@@ -53,10 +55,11 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
           Index_type  len  = unpack_index_list_lengths[l];
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
-              HALOEXCHANGE_UNPACK_BODY;
-            }
+            RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+              for (Index_type i = 0; i < len; i++) {
+                HALOEXCHANGE_UNPACK_BODY;
+              }
+            )
             buffer += len;
           }
         }
@@ -81,10 +84,11 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
             auto haloexchange_pack_base_lam = [=](Index_type i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
-            #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
-              haloexchange_pack_base_lam(i);
-            }
+            RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+              for (Index_type i = 0; i < len; i++) {
+                haloexchange_pack_base_lam(i);
+              }
+            )
             buffer += len;
           }
         }
@@ -98,10 +102,11 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
             auto haloexchange_unpack_base_lam = [=](Index_type i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
-            #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
-              haloexchange_unpack_base_lam(i);
-            }
+            RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+              for (Index_type i = 0; i < len; i++) {
+                haloexchange_unpack_base_lam(i);
+              }
+            )
             buffer += len;
           }
         }
@@ -114,7 +119,7 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
     case RAJA_OpenMP : {
 
-      using EXEC_POL = RAJA::omp_parallel_for_exec;
+      using EXEC_POL = OMP_EXEC_POL;
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -168,5 +173,23 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -18,7 +18,8 @@ namespace apps
 {
 
 
-void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void HALOEXCHANGE_FUSED::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -65,16 +66,17 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           }
         }
 #else
-        #pragma omp parallel for
-        for (Index_type j = 0; j < pack_index; j++) {
-          Real_ptr   buffer = pack_ptr_holders[j].buffer;
-          Int_ptr    list   = pack_ptr_holders[j].list;
-          Real_ptr   var    = pack_ptr_holders[j].var;
-          Index_type len    = pack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
-            HALOEXCHANGE_FUSED_PACK_BODY;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type j = 0; j < pack_index; j++) {
+            Real_ptr   buffer = pack_ptr_holders[j].buffer;
+            Int_ptr    list   = pack_ptr_holders[j].list;
+            Real_ptr   var    = pack_ptr_holders[j].var;
+            Index_type len    = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_PACK_BODY;
+            }
           }
-        }
+        )
 #endif
 
         Index_type unpack_index = 0;
@@ -107,16 +109,17 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           }
         }
 #else
-        #pragma omp parallel for
-        for (Index_type j = 0; j < unpack_index; j++) {
-          Real_ptr   buffer = unpack_ptr_holders[j].buffer;
-          Int_ptr    list   = unpack_ptr_holders[j].list;
-          Real_ptr   var    = unpack_ptr_holders[j].var;
-          Index_type len    = unpack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
-            HALOEXCHANGE_FUSED_UNPACK_BODY;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type j = 0; j < unpack_index; j++) {
+            Real_ptr   buffer = unpack_ptr_holders[j].buffer;
+            Int_ptr    list   = unpack_ptr_holders[j].list;
+            Real_ptr   var    = unpack_ptr_holders[j].var;
+            Index_type len    = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_UNPACK_BODY;
+            }
           }
-        }
+        )
 #endif
 
       }
@@ -162,14 +165,15 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           }
         }
 #else
-        #pragma omp parallel for
-        for (Index_type j = 0; j < pack_index; j++) {
-          auto       pack_lambda = pack_lambdas[j];
-          Index_type len         = pack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
-            pack_lambda(i);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type j = 0; j < pack_index; j++) {
+            auto       pack_lambda = pack_lambdas[j];
+            Index_type len         = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              pack_lambda(i);
+            }
           }
-        }
+        )
 #endif
 
         Index_type unpack_index = 0;
@@ -200,14 +204,15 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
           }
         }
 #else
-        #pragma omp parallel for
-        for (Index_type j = 0; j < unpack_index; j++) {
-          auto       unpack_lambda = unpack_lambdas[j];
-          Index_type len           = unpack_lens[j];
-          for (Index_type i = 0; i < len; i++) {
-            unpack_lambda(i);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type j = 0; j < unpack_index; j++) {
+            auto       unpack_lambda = unpack_lambdas[j];
+            Index_type len           = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              unpack_lambda(i);
+            }
           }
-        }
+        )
 #endif
 
       }
@@ -307,5 +312,23 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 #endif
 }
 
+void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -18,7 +18,8 @@ namespace apps
 {
 
 
-void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void LTIMES_NOVIEW::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -38,16 +39,17 @@ void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
-                LTIMES_NOVIEW_BODY;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  LTIMES_NOVIEW_BODY;
+                }
               }
             }
           }
-        }
+        )
 
       }
       stopTimer();
@@ -60,16 +62,17 @@ void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type z = 0; z < num_z; ++z ) {
-          for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
-              for (Index_type d = 0; d < num_d; ++d ) {
-                ltimesnoview_lam(d, z, g, m);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  ltimesnoview_lam(d, z, g, m);
+                }
               }
             }
           }
-        }
+        )
 
       }
       stopTimer();
@@ -81,7 +84,7 @@ void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<1, RAJA::omp_parallel_for_exec, // z
+          RAJA::statement::For<1, OMP_EXEC_POL, // z
             RAJA::statement::For<2, RAJA::loop_exec,           // g
               RAJA::statement::For<3, RAJA::loop_exec,         // m
                 RAJA::statement::For<0, RAJA::loop_exec,       // d
@@ -119,5 +122,23 @@ void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void LTIMES_NOVIEW::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace rajaperf {
 namespace apps {
 
 
-void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+template < typename OMP_EXEC_POL >
+void MASS3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -33,63 +34,64 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#pragma omp parallel for
-      for (int e = 0; e < NE; ++e) {
+      RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+        for (int e = 0; e < NE; ++e) {
 
-        MASS3DPA_0_CPU
+          MASS3DPA_0_CPU
 
-         CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D){
-            MASS3DPA_1
+           CPU_FOREACH(dy, y, MPA_D1D) {
+            CPU_FOREACH(dx, x, MPA_D1D){
+              MASS3DPA_1
+            }
+            CPU_FOREACH(dx, x, MPA_Q1D) {
+              MASS3DPA_2
+            }
           }
-          CPU_FOREACH(dx, x, MPA_Q1D) {
-            MASS3DPA_2
-          }
-        }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
-            MASS3DPA_3
+          CPU_FOREACH(dy, y, MPA_D1D) {
+            CPU_FOREACH(qx, x, MPA_Q1D) {
+              MASS3DPA_3
+            }
           }
-        }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
-            MASS3DPA_4
+          CPU_FOREACH(qy, y, MPA_Q1D) {
+            CPU_FOREACH(qx, x, MPA_Q1D) {
+              MASS3DPA_4
+            }
           }
-        }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(qx, x, MPA_Q1D) {
-            MASS3DPA_5
+          CPU_FOREACH(qy, y, MPA_Q1D) {
+            CPU_FOREACH(qx, x, MPA_Q1D) {
+              MASS3DPA_5
+            }
           }
-        }
 
-        CPU_FOREACH(d, y, MPA_D1D) {
-          CPU_FOREACH(q, x, MPA_Q1D) {
-            MASS3DPA_6
+          CPU_FOREACH(d, y, MPA_D1D) {
+            CPU_FOREACH(q, x, MPA_Q1D) {
+              MASS3DPA_6
+            }
           }
-        }
 
-        CPU_FOREACH(qy, y, MPA_Q1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
-            MASS3DPA_7
+          CPU_FOREACH(qy, y, MPA_Q1D) {
+            CPU_FOREACH(dx, x, MPA_D1D) {
+              MASS3DPA_7
+            }
           }
-        }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
-            MASS3DPA_8
+          CPU_FOREACH(dy, y, MPA_D1D) {
+            CPU_FOREACH(dx, x, MPA_D1D) {
+              MASS3DPA_8
+            }
           }
-        }
 
-        CPU_FOREACH(dy, y, MPA_D1D) {
-          CPU_FOREACH(dx, x, MPA_D1D) {
-            MASS3DPA_9
+          CPU_FOREACH(dy, y, MPA_D1D) {
+            CPU_FOREACH(dx, x, MPA_D1D) {
+              MASS3DPA_9
+            }
           }
-        }
 
-      } // element loop
+        } // element loop
+      )
     }
     stopTimer();
 
@@ -242,5 +244,23 @@ void MASS3DPA::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+void MASS3DPA::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
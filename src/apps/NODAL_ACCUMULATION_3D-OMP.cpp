@@ -20,7 +20,8 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void NODAL_ACCUMULATION_3D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,29 +41,30 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          NODAL_ACCUMULATION_3D_BODY_INDEX;
-
-          Real_type val = 0.125 * vol[i];
-
-          #pragma omp atomic
-          x0[i] += val;
-          #pragma omp atomic
-          x1[i] += val;
-          #pragma omp atomic
-          x2[i] += val;
-          #pragma omp atomic
-          x3[i] += val;
-          #pragma omp atomic
-          x4[i] += val;
-          #pragma omp atomic
-          x5[i] += val;
-          #pragma omp atomic
-          x6[i] += val;
-          #pragma omp atomic
-          x7[i] += val;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            NODAL_ACCUMULATION_3D_BODY_INDEX;
+
+            Real_type val = 0.125 * vol[i];
+
+            _Pragma("omp atomic")
+            x0[i] += val;
+            _Pragma("omp atomic")
+            x1[i] += val;
+            _Pragma("omp atomic")
+            x2[i] += val;
+            _Pragma("omp atomic")
+            x3[i] += val;
+            _Pragma("omp atomic")
+            x4[i] += val;
+            _Pragma("omp atomic")
+            x5[i] += val;
+            _Pragma("omp atomic")
+            x6[i] += val;
+            _Pragma("omp atomic")
+            x7[i] += val;
+          }
+        )
 
       }
       stopTimer();
@@ -98,10 +100,11 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          nodal_accumulation_3d_lam(ii);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+            nodal_accumulation_3d_lam(ii);
+          }
+        )
 
       }
       stopTimer();
@@ -123,7 +126,7 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           zones, nodal_accumulation_3d_lam);
 
       }
@@ -143,5 +146,23 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 #endif
 }
 
+void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -121,5 +121,12 @@ void PRESSURE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+void PRESSURE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  // loops run in one parallel region with static schedules and no waits
+  // between them, so they can't take schedule tunings
+  addVariantTuningName(vid, getDefaultTuningName());
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "DAXPY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t width, size_t unroll >
+void DAXPY::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    const pack va(a);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t) {
+          ( pack::load(&y[i]) + va * pack::load(&x[i]) ).store(&y[i]);
+        },
+        [&](Index_type i) {
+          DAXPY_BODY;
+        });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DAXPY : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(DAXPY)
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
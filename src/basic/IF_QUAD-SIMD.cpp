@@ -0,0 +1,73 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "IF_QUAD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t width, size_t unroll >
+void IF_QUAD::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    const pack vzero(0.0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t) {
+          const pack va = pack::load(&a[i]);
+          const pack vb = pack::load(&b[i]);
+          const pack vc = pack::load(&c[i]);
+          const pack s = vb*vb - pack(4.0)*va*vc;
+          const auto real_roots = ( s >= vzero );
+          const pack sq = sqrt( select(real_roots, s, vzero) );
+          const pack va2 = pack(2.0)*va;
+          select(real_roots, (-vb+sq)/va2, vzero).store(&x2[i]);
+          select(real_roots, (-vb-sq)/va2, vzero).store(&x1[i]);
+        },
+        [&](Index_type i) {
+          IF_QUAD_BODY;
+        });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  IF_QUAD : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(IF_QUAD)
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
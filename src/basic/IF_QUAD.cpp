@@ -41,6 +41,8 @@ IF_QUAD::IF_QUAD(const RunParams& params)
   setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
+  setVariantDefined( Base_SIMD );
+
   setVariantDefined( Base_OpenMP );
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
@@ -203,5 +203,12 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void INDEXLIST::setOpenMPTuningDefinitions(VariantID vid)
+{
+  // scans split work among threads explicitly or with inscan reductions,
+  // so schedule tunings would not change them
+  addVariantTuningName(vid, getDefaultTuningName());
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "MULADDSUB.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < size_t width, size_t unroll >
+void MULADDSUB::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  MULADDSUB_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t) {
+          const pack vin1 = pack::load(&in1[i]);
+          const pack vin2 = pack::load(&in2[i]);
+          ( vin1 * vin2 ).store(&out1[i]);
+          ( vin1 + vin2 ).store(&out2[i]);
+          ( vin1 - vin2 ).store(&out3[i]);
+        },
+        [&](Index_type i) {
+          MULADDSUB_BODY;
+        });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  MULADDSUB : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(MULADDSUB)
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
@@ -20,8 +20,15 @@ namespace basic
 //#define USE_OMP_COLLAPSE
 #undef USE_OMP_COLLAPSE
 
+#if defined(USE_OMP_COLLAPSE)
+#define NESTED_INIT_OMP_COLLAPSE collapse(3)
+#else
+#define NESTED_INIT_OMP_COLLAPSE
+#endif
 
-void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+
+template < typename OMP_EXEC_POL >
+void NESTED_INIT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,18 +47,15 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
-          #pragma omp parallel for collapse(3)
-#else
-          #pragma omp parallel for
-#endif
-          for (Index_type k = 0; k < nk; ++k ) {
-            for (Index_type j = 0; j < nj; ++j ) {
-              for (Index_type i = 0; i < ni; ++i ) {
-                NESTED_INIT_BODY;
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, NESTED_INIT_OMP_COLLAPSE,
+            for (Index_type k = 0; k < nk; ++k ) {
+              for (Index_type j = 0; j < nj; ++j ) {
+                for (Index_type i = 0; i < ni; ++i ) {
+                  NESTED_INIT_BODY;
+                }
               }
             }
-          }
+          )
 
       }
       stopTimer();
@@ -64,18 +68,15 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
-          #pragma omp parallel for collapse(3)
-#else
-          #pragma omp parallel for
-#endif
-          for (Index_type k = 0; k < nk; ++k ) {
-            for (Index_type j = 0; j < nj; ++j ) {
-              for (Index_type i = 0; i < ni; ++i ) {
-                nestedinit_lam(i, j, k);
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, NESTED_INIT_OMP_COLLAPSE,
+            for (Index_type k = 0; k < nk; ++k ) {
+              for (Index_type j = 0; j < nj; ++j ) {
+                for (Index_type i = 0; i < ni; ++i ) {
+                  nestedinit_lam(i, j, k);
+                }
               }
             }
-          }
+          )
 
       }
       stopTimer();
@@ -96,7 +97,7 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #else
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<2, RAJA::omp_parallel_for_exec,  // k
+          RAJA::statement::For<2, OMP_EXEC_POL,  // k
             RAJA::statement::For<1, RAJA::loop_exec,            // j
               RAJA::statement::For<0, RAJA::loop_exec,          // i
                 RAJA::statement::Lambda<0>
@@ -132,5 +133,23 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
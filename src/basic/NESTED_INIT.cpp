@@ -82,9 +82,7 @@ void NESTED_INIT::updateChecksum(VariantID vid, size_t tune_idx)
 
 void NESTED_INIT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  (void) vid;
-  RAJA::free_aligned(m_array);
-  m_array = 0;
+  deallocData(m_array, vid);
 }
 
 } // end namespace basic
@@ -18,7 +18,8 @@ namespace basic
 {
 
 
-void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void PI_REDUCE::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -37,10 +38,11 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         Real_type pi = m_pi_init;
 
-        #pragma omp parallel for reduction(+:pi)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          PI_REDUCE_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:pi),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PI_REDUCE_BODY;
+          }
+        )
 
         m_pi = 4.0 * pi;
 
@@ -62,10 +64,11 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         Real_type pi = m_pi_init;
 
-        #pragma omp parallel for reduction(+:pi)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          pi += pireduce_base_lam(i);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:pi),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            pi += pireduce_base_lam(i);
+          }
+        )
 
         m_pi = 4.0 * pi;
 
@@ -82,7 +85,7 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         RAJA::ReduceSum<RAJA::omp_reduce, Real_type> pi(m_pi_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
             PI_REDUCE_BODY;
@@ -107,5 +110,23 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
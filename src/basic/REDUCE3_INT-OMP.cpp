@@ -19,7 +19,8 @@ namespace basic
 {
 
 
-void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void REDUCE3_INT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,12 +41,12 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
         Int_type vmin = m_vmin_init;
         Int_type vmax = m_vmax_init;
 
-        #pragma omp parallel for reduction(+:vsum), \
-                                 reduction(min:vmin), \
-                                 reduction(max:vmax)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE3_INT_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL,
+          reduction(+:vsum) reduction(min:vmin) reduction(max:vmax),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE3_INT_BODY;
+          }
+        )
 
         m_vsum += vsum;
         m_vmin = RAJA_MIN(m_vmin, vmin);
@@ -70,14 +71,14 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
         Int_type vmin = m_vmin_init;
         Int_type vmax = m_vmax_init;
 
-        #pragma omp parallel for reduction(+:vsum), \
-                                 reduction(min:vmin), \
-                                 reduction(max:vmax)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          vsum += reduce3int_base_lam(i);
-          vmin = RAJA_MIN(vmin, reduce3int_base_lam(i));
-          vmax = RAJA_MAX(vmax, reduce3int_base_lam(i));
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL,
+          reduction(+:vsum) reduction(min:vmin) reduction(max:vmax),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            vsum += reduce3int_base_lam(i);
+            vmin = RAJA_MIN(vmin, reduce3int_base_lam(i));
+            vmax = RAJA_MAX(vmax, reduce3int_base_lam(i));
+          }
+        )
 
         m_vsum += vsum;
         m_vmin = RAJA_MIN(m_vmin, vmin);
@@ -98,7 +99,7 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
         RAJA::ReduceMin<RAJA::omp_reduce, Int_type> vmin(m_vmin_init);
         RAJA::ReduceMax<RAJA::omp_reduce, Int_type> vmax(m_vmax_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           REDUCE3_INT_BODY_RAJA;
         });
@@ -124,5 +125,23 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace basic
 {
 
 
-void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void REDUCE_STRUCT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,15 +41,13 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
         Real_type xmin = m_init_min; Real_type ymin = m_init_min;
         Real_type xmax = m_init_max; Real_type ymax = m_init_max;
 
-        #pragma omp parallel for reduction(+:xsum), \
-                                 reduction(min:xmin), \
-                                 reduction(max:xmax), \
-                                 reduction(+:ysum), \
-                                 reduction(min:ymin), \
-                                 reduction(max:ymax)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE_STRUCT_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL,
+          reduction(+:xsum) reduction(min:xmin) reduction(max:xmax)
+          reduction(+:ysum) reduction(min:ymin) reduction(max:ymax),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE_STRUCT_BODY;
+          }
+        )
 
         points.SetCenter(xsum/points.N, ysum/points.N);
         points.SetXMin(xmin); 
@@ -80,20 +79,18 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
         Real_type xmin = m_init_min; Real_type ymin = m_init_min;
         Real_type xmax = m_init_max; Real_type ymax = m_init_max;
 
-        #pragma omp parallel for reduction(+:xsum), \
-                                 reduction(min:xmin), \
-                                 reduction(max:xmax), \
-                                 reduction(+:ysum), \
-                                 reduction(min:ymin), \
-                                 reduction(max:ymax)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          xsum += reduce_struct_x_base_lam(i);
-          xmin = RAJA_MIN(xmin, reduce_struct_x_base_lam(i));
-          xmax = RAJA_MAX(xmax, reduce_struct_x_base_lam(i));
-          ysum += reduce_struct_y_base_lam(i);
-          ymin = RAJA_MIN(ymin, reduce_struct_y_base_lam(i));
-          ymax = RAJA_MAX(ymax, reduce_struct_y_base_lam(i));
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL,
+          reduction(+:xsum) reduction(min:xmin) reduction(max:xmax)
+          reduction(+:ysum) reduction(min:ymin) reduction(max:ymax),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            xsum += reduce_struct_x_base_lam(i);
+            xmin = RAJA_MIN(xmin, reduce_struct_x_base_lam(i));
+            xmax = RAJA_MAX(xmax, reduce_struct_x_base_lam(i));
+            ysum += reduce_struct_y_base_lam(i);
+            ymin = RAJA_MIN(ymin, reduce_struct_y_base_lam(i));
+            ymax = RAJA_MAX(ymax, reduce_struct_y_base_lam(i));
+          }
+        )
 
         points.SetCenter(xsum/points.N, ysum/points.N);
         points.SetXMin(xmin); 
@@ -120,7 +117,7 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
         RAJA::ReduceMax<RAJA::omp_reduce, Real_type> xmax(m_init_max); 
         RAJA::ReduceMax<RAJA::omp_reduce, Real_type> ymax(m_init_max);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           REDUCE_STRUCT_BODY_RAJA;
         });
@@ -150,5 +147,23 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
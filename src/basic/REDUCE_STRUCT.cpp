@@ -71,7 +71,7 @@ void REDUCE_STRUCT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   allocAndInitData(m_y, getActualProblemSize(), vid);
   Real_type dx = Lx/(Real_type)(getActualProblemSize());
   Real_type dy = Ly/(Real_type)(getActualProblemSize());
-  for (int i=0;i<getActualProblemSize();i++){ \
+  for (Index_type i=0;i<getActualProblemSize();i++){ \
       m_x[i] = i*dx;  
       m_y[i] = i*dy; 
   } 
@@ -32,7 +32,8 @@ Real_type trap_int_func(Real_type x,
 }
 
 
-void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void TRAP_INT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -51,10 +52,11 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         Real_type sumx = m_sumx_init;
 
-        #pragma omp parallel for reduction(+:sumx)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          TRAP_INT_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:sumx),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRAP_INT_BODY;
+          }
+        )
 
         m_sumx += sumx * h;
 
@@ -76,10 +78,11 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         Real_type sumx = m_sumx_init;
 
-        #pragma omp parallel for reduction(+:sumx)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          sumx += trapint_base_lam(i);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:sumx),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            sumx += trapint_base_lam(i);
+          }
+        )
 
         m_sumx += sumx * h;
 
@@ -96,7 +99,7 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sumx(m_sumx_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           TRAP_INT_BODY;
         });
@@ -120,5 +123,23 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+void TRAP_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
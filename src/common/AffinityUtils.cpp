@@ -0,0 +1,238 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "AffinityUtils.hpp"
+
+#include "OutputUtils.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+//
+// Binding and CPUs that threads are bound to, in order of thread assignment.
+// Both are per thread, so OpenMP regions started by concurrent threads
+// (co-run) can be bound to different CPUs.
+//
+static thread_local RunParams::ThreadBinding thread_binding = RunParams::ThreadBinding::NoBinding;
+static thread_local std::vector<int> bind_cpus;
+
+bool parseCPUList(const std::string& str, std::vector<int>& cpus)
+{
+  cpus.clear();
+
+  std::istringstream list(str);
+  std::string range;
+  while ( std::getline(list, range, ',') ) {
+    char* end = nullptr;
+    long first = std::strtol(range.c_str(), &end, 10);
+    long last = first;
+    if ( end == range.c_str() || first < 0 ) {
+      return false;
+    }
+    if ( *end == '-' ) {
+      const char* last_begin = end + 1;
+      last = std::strtol(last_begin, &end, 10);
+      if ( end == last_begin || last < first ) {
+        return false;
+      }
+    }
+    if ( *end != '\0' ) {
+      return false;
+    }
+    for (long cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+  }
+
+  return !cpus.empty();
+}
+
+/*
+ * Return CPUs calling thread may run on.
+ */
+static std::vector<int> getThreadCPUs()
+{
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if ( sched_getaffinity(0, sizeof(mask), &mask) == 0 ) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if ( CPU_ISSET(cpu, &mask) ) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  return cpus;
+}
+
+//
+// CPUs of the process, taken at start up before any thread is bound;
+// binding OpenMP threads also binds the main thread (OpenMP thread 0)
+// to one CPU, so its CPUs no longer give those of the process.
+//
+static const std::vector<int> process_cpus = getThreadCPUs();
+
+void getAvailableCPUs(std::vector<int>& cpus)
+{
+  cpus = process_cpus;
+}
+
+bool bindThreadToCPUs(const std::vector<int>& cpus)
+{
+#if defined(__linux__)
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for (int cpu : cpus) {
+    CPU_SET(cpu, &mask);
+  }
+  return !cpus.empty() && sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+  (void) cpus;
+  return false;
+#endif
+}
+
+void setThreadBinding(RunParams::ThreadBinding binding,
+                      const std::vector<int>& cpu_list)
+{
+  thread_binding = binding;
+  bind_cpus.clear();
+
+  if ( binding == RunParams::ThreadBinding::ListBinding ) {
+    bind_cpus = cpu_list;
+  } else if ( binding != RunParams::ThreadBinding::NoBinding ) {
+    getAvailableCPUs(bind_cpus);
+  }
+}
+
+void bindOpenMPThreads()
+{
+#if defined(__linux__) && defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( thread_binding == RunParams::ThreadBinding::NoBinding ||
+       bind_cpus.empty() ) {
+    return;
+  }
+
+  // binding is per thread, so OpenMP threads read that of this thread
+  const RunParams::ThreadBinding binding = thread_binding;
+  const std::vector<int>& cpus = bind_cpus;
+
+  const int ncpus = static_cast<int>(cpus.size());
+  bool failed = false;
+
+  #pragma omp parallel
+  {
+    const int nthreads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+
+    int icpu = tid % ncpus;
+    if ( binding == RunParams::ThreadBinding::SpreadBinding &&
+         nthreads < ncpus ) {
+      icpu = static_cast<int>(static_cast<long>(tid) * ncpus / nthreads);
+    }
+
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpus[icpu], &mask);
+    if ( sched_setaffinity(0, sizeof(mask), &mask) != 0 ) {
+      #pragma omp atomic write
+      failed = true;
+    }
+  }
+
+  static bool warned = false;
+  if ( failed && !warned ) {
+    getCout() << "\n Can't bind all OpenMP threads to "
+              << RunParams::ThreadBindingToStr(thread_binding)
+              << " CPUs; check CPUs are available to the process" << std::endl;
+    warned = true;
+  }
+#endif
+}
+
+int getNUMANode(int cpu)
+{
+  static std::map<int, int> cpu_nodes;
+  static std::mutex cpu_nodes_mutex;
+
+  std::lock_guard<std::mutex> lock(cpu_nodes_mutex);
+
+  auto node_iter = cpu_nodes.find(cpu);
+  if ( node_iter != cpu_nodes.end() ) {
+    return node_iter->second;
+  }
+
+  int node = -1;
+#if defined(__linux__)
+  //
+  // sysfs directory of each CPU has a link named for its NUMA node.
+  //
+  std::string cpu_dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+  DIR* dir = opendir(cpu_dir.c_str());
+  if ( dir ) {
+    while ( struct dirent* entry = readdir(dir) ) {
+      std::string name(entry->d_name);
+      if ( name.size() > 4 && name.compare(0, 4, "node") == 0 &&
+           name.find_first_not_of("0123456789", 4) == std::string::npos ) {
+        node = std::atoi(name.c_str() + 4);
+        break;
+      }
+    }
+    closedir(dir);
+  }
+#endif
+
+  cpu_nodes[cpu] = node;
+  return node;
+}
+
+void getOpenMPThreadPlacement(std::vector<int>& cpus,
+                              std::vector<int>& numa_nodes)
+{
+  cpus.clear();
+  numa_nodes.clear();
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  cpus.resize(omp_get_max_threads(), -1);
+
+  #pragma omp parallel num_threads(static_cast<int>(cpus.size()))
+  {
+#if defined(__linux__)
+    cpus[omp_get_thread_num()] = sched_getcpu();
+#endif
+  }
+
+  for (int cpu : cpus) {
+    numa_nodes.push_back( cpu >= 0 ? getNUMANode(cpu) : -1 );
+  }
+#endif
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
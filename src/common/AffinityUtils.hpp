@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for binding OpenMP threads to CPUs and reporting where they run.
+///
+
+#ifndef RAJAPerf_AffinityUtils_HPP
+#define RAJAPerf_AffinityUtils_HPP
+
+#include "RunParams.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Parse list of CPU ids and ranges, such as "0-3,8,10-11".
+ *
+ * Return false if string is not a valid list.
+ */
+bool parseCPUList(const std::string& str, std::vector<int>& cpus);
+
+/*!
+ * \brief Get CPUs the process may run on when it started, before any
+ *        thread was bound, in increasing id order; empty if they can't be
+ *        determined.
+ */
+void getAvailableCPUs(std::vector<int>& cpus);
+
+/*!
+ * \brief Bind calling thread to given CPUs; false if it can't be bound.
+ */
+bool bindThreadToCPUs(const std::vector<int>& cpus);
+
+/*!
+ * \brief Set how OpenMP threads are bound to CPUs by bindOpenMPThreads.
+ *
+ * Compact and spread binding use the CPUs the process may run on when this
+ * is called, in increasing id order; list binding uses the given CPUs.
+ * Binding applies to OpenMP regions started by the calling thread.
+ */
+void setThreadBinding(RunParams::ThreadBinding binding,
+                      const std::vector<int>& cpu_list);
+
+/*!
+ * \brief Bind each thread of an OpenMP parallel region to one CPU as set
+ *        by setThreadBinding; does nothing if there is no binding.
+ *
+ * Thread i of n is bound to CPU i (compact or list; wrapping if there are
+ * more threads than CPUs) or CPU i*ncpus/n (spread) of the binding CPUs.
+ * Binding is Linux only.
+ */
+void bindOpenMPThreads();
+
+/*!
+ * \brief Return NUMA node of given CPU, or -1 if it can't be determined.
+ */
+int getNUMANode(int cpu);
+
+/*!
+ * \brief Get CPU and NUMA node each thread of an OpenMP parallel region
+ *        is running on (-1 where unknown); vectors are empty without OpenMP.
+ */
+void getOpenMPThreadPlacement(std::vector<int>& cpus,
+                              std::vector<int>& numa_nodes);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
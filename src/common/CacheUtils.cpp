@@ -0,0 +1,151 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CacheUtils.hpp"
+
+#include "RPTypes.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+//
+// Cache line size (bytes) assumed when reading scrub buffer.
+//
+static const size_t scrub_line_bytes = 64;
+
+/*
+ * Return size (bytes) of given data cache level, or default if the
+ * size can't be determined.
+ */
+long getCacheSize(int level, long default_size)
+{
+  long size = -1;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  switch ( level ) {
+    case 1 : size = sysconf(_SC_LEVEL1_DCACHE_SIZE); break;
+    case 2 : size = sysconf(_SC_LEVEL2_CACHE_SIZE); break;
+    case 3 : size = sysconf(_SC_LEVEL3_CACHE_SIZE); break;
+    default : { }
+  }
+#else
+  (void)level;
+#endif
+  return ( size > 0 ) ? size : default_size;
+}
+
+/*
+ * Count distinct sets of CPUs sharing a data cache of given level, using
+ * Linux sysfs cache descriptions.
+ */
+int getNumCacheInstances(int level)
+{
+  std::set<std::string> shared_cpu_lists;
+
+  long num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+  for (long icpu = 0; icpu < num_cpus; ++icpu) {
+    std::string cpu_dir = "/sys/devices/system/cpu/cpu" +
+                          std::to_string(icpu) + "/cache/index";
+    for (int index = 0; ; ++index) {
+      std::string index_dir = cpu_dir + std::to_string(index);
+      std::ifstream level_file(index_dir + "/level");
+      if ( !level_file ) {
+        break;
+      }
+      int index_level = 0;
+      std::string type;
+      level_file >> index_level;
+      std::ifstream(index_dir + "/type") >> type;
+      if ( index_level == level && type != "Instruction" ) {
+        std::string cpu_list;
+        std::ifstream(index_dir + "/shared_cpu_list") >> cpu_list;
+        shared_cpu_lists.insert(cpu_list);
+      }
+    }
+  }
+
+  return shared_cpu_lists.empty() ? 1
+                                  : static_cast<int>(shared_cpu_lists.size());
+}
+
+void getCacheLevels(int num_threads,
+                    std::vector<std::string>& level_names,
+                    std::vector<double>& level_capacity)
+{
+  //
+  // L1 and L2 are private to each core and L3 is shared, so capacity of
+  // private levels scales with number of threads.
+  //
+  const double l1_size = getCacheSize(1, 32*1024);
+  const double l2_size = getCacheSize(2, 1024*1024);
+  const double l3_size = getCacheSize(3, 32*1024*1024);
+
+  level_names = { "L1", "L2", "L3", "DRAM" };
+  level_capacity = { l1_size * num_threads,
+                     l2_size * num_threads,
+                     std::max(l3_size, l2_size * num_threads),
+                     0.0 };
+}
+
+size_t getCacheLevel(const std::vector<double>& level_capacity,
+                     double footprint)
+{
+  for (size_t il = 0; il+1 < level_capacity.size(); ++il) {
+    if ( footprint <= level_capacity[il] ) {
+      return il;
+    }
+  }
+  return level_capacity.empty() ? 0 : level_capacity.size() - 1;
+}
+
+size_t getCacheScrubBytes()
+{
+  static const size_t scrub_bytes =
+      2 * ( getCacheSize(2, 1024*1024) * getNumCacheInstances(2) +
+            getCacheSize(3, 32*1024*1024) * getNumCacheInstances(3) );
+  return scrub_bytes;
+}
+
+void scrubCaches()
+{
+  static std::vector<Real_type> scrub_buffer;
+
+  const Index_type len = getCacheScrubBytes() / sizeof(Real_type);
+  const Index_type stride = scrub_line_bytes / sizeof(Real_type);
+
+  if ( scrub_buffer.empty() ) {
+    scrub_buffer.resize(len, 1.0);
+  }
+  const Real_type* buf = scrub_buffer.data();
+
+  Real_type sum = 0.0;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static) reduction(+:sum)
+#endif
+  for (Index_type i = 0; i < len; i += stride) {
+    sum += buf[i];
+  }
+
+  // keep compiler from removing the reads
+  static volatile Real_type scrub_sink = 0.0;
+  scrub_sink = scrub_sink + sum;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
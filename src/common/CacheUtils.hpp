@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for querying the host cache hierarchy and evicting host caches.
+///
+
+#ifndef RAJAPerf_CacheUtils_HPP
+#define RAJAPerf_CacheUtils_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Return size (bytes) of one instance of given data cache level
+ *        (1, 2, or 3), or default size if it can't be determined.
+ */
+long getCacheSize(int level, long default_size);
+
+/*!
+ * \brief Return number of instances of given data cache level on the host;
+ *        for example, the number of sockets for a per-socket L3.
+ *
+ * Returns 1 if the number can't be determined.
+ */
+int getNumCacheInstances(int level);
+
+/*!
+ * \brief Get names (L1, L2, L3, DRAM) and capacities (bytes) of host memory
+ *        levels available to given number of threads.
+ *
+ * L1 and L2 are private to each core, so their capacity scales with number
+ * of threads; L3 is shared, so its capacity is that of one L3 cache (or of
+ * all L2 caches of the threads, if larger). The last level (DRAM) has
+ * unbounded capacity, given as zero.
+ */
+void getCacheLevels(int num_threads,
+                    std::vector<std::string>& level_names,
+                    std::vector<double>& level_capacity);
+
+/*!
+ * \brief Return index of fastest memory level with capacity that holds
+ *        given footprint (bytes); the last level holds any footprint.
+ */
+size_t getCacheLevel(const std::vector<double>& level_capacity,
+                     double footprint);
+
+/*!
+ * \brief Return size (bytes) of buffer read by scrubCaches, twice the
+ *        total capacity of all L2 and L3 cache instances on the host.
+ */
+size_t getCacheScrubBytes();
+
+/*!
+ * \brief Evict kernel data from host caches by reading a scrub buffer,
+ *        with all OpenMP threads when available.
+ *
+ * The buffer is allocated on first use.
+ */
+void scrubCaches();
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
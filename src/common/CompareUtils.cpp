@@ -0,0 +1,204 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CompareUtils.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace rajaperf
+{
+
+namespace
+{
+
+/*
+ * Return position just past value of given key in JSON line, searching
+ * from given position, or npos if key is not there.
+ */
+size_t findJSONValue(const std::string& line, const std::string& key,
+                     size_t pos = 0)
+{
+  const std::string quoted_key = "\"" + key + "\":";
+  pos = line.find(quoted_key, pos);
+  return ( pos == std::string::npos ) ? pos : pos + quoted_key.size();
+}
+
+/*
+ * Get JSON string value of given key; false if key is missing or its
+ * value is not a string.
+ */
+bool getJSONStringValue(const std::string& line, const std::string& key,
+                        std::string& val)
+{
+  size_t pos = findJSONValue(line, key);
+  if ( pos == std::string::npos || pos >= line.size() || line[pos] != '"' ) {
+    return false;
+  }
+  val.clear();
+  for (++pos; pos < line.size() && line[pos] != '"'; ++pos) {
+    if ( line[pos] == '\\' && pos+1 < line.size() ) {
+      ++pos;
+    }
+    val.push_back(line[pos]);
+  }
+  return pos < line.size();
+}
+
+/*
+ * Get JSON number value of given key, searching from given position;
+ * false if key is missing or its value is not a number (e.g. null).
+ */
+bool getJSONNumberValue(const std::string& line, const std::string& key,
+                        double& val, size_t pos = 0)
+{
+  pos = findJSONValue(line, key, pos);
+  if ( pos == std::string::npos ) {
+    return false;
+  }
+  const char* begin = line.c_str() + pos;
+  char* end = nullptr;
+  val = std::strtod(begin, &end);
+  return end != begin;
+}
+
+/*
+ * Split CSV line into fields with surrounding whitespace removed.
+ */
+std::vector<std::string> splitCSVLine(const std::string& line)
+{
+  std::vector<std::string> fields;
+  std::istringstream fields_str(line);
+  std::string field;
+  while ( std::getline(fields_str, field, ',') ) {
+    size_t first = field.find_first_not_of(" \t\r");
+    size_t last = field.find_last_not_of(" \t\r");
+    fields.push_back( ( first == std::string::npos ) ?
+                      std::string() : field.substr(first, last - first + 1) );
+  }
+  return fields;
+}
+
+/*
+ * Read results of data file, one JSON record per line.
+ */
+void readJSONResults(std::istream& file, std::vector<BaselineResult>& results)
+{
+  std::string line;
+  while ( std::getline(file, line) ) {
+
+    std::string record;
+    if ( !getJSONStringValue(line, "record", record) || record != "result" ) {
+      continue;
+    }
+
+    BaselineResult result;
+    if ( !getJSONStringValue(line, "kernel", result.kernel) ||
+         !getJSONStringValue(line, "variant", result.variant) ||
+         !getJSONStringValue(line, "tuning", result.tuning) ||
+         !getJSONNumberValue(line, "avg_time", result.avg_time) ) {
+      continue;
+    }
+    if ( !getJSONNumberValue(line, "min_time", result.min_time) ) {
+      result.min_time = result.avg_time;
+    }
+    if ( !getJSONNumberValue(line, "max_time", result.max_time) ) {
+      result.max_time = result.avg_time;
+    }
+    // times are reported for the nominal reps, even when a different
+    // number (reps_run) was run
+    if ( !getJSONNumberValue(line, "reps", result.reps) ) {
+      result.reps = 0.0;
+    }
+
+    size_t samples_pos = findJSONValue(line, "samples");
+    double count = 0.0;
+    if ( samples_pos != std::string::npos &&
+         getJSONNumberValue(line, "count", count, samples_pos) &&
+         getJSONNumberValue(line, "mean", result.sample_mean, samples_pos) &&
+         getJSONNumberValue(line, "stddev", result.sample_stddev, samples_pos) ) {
+      result.sample_count = static_cast<size_t>(count);
+    }
+
+    results.push_back(result);
+  }
+}
+
+/*
+ * Read results of timing file; first line is title, next two lines are
+ * variant and tuning of each column, and each following line holds times
+ * of one kernel.
+ */
+void readCSVResults(std::istream& file, std::vector<BaselineResult>& results)
+{
+  std::string line;
+  std::vector<std::string> variants;
+  std::vector<std::string> tunings;
+
+  std::getline(file, line);
+  if ( std::getline(file, line) ) {
+    variants = splitCSVLine(line);
+  }
+  if ( std::getline(file, line) ) {
+    tunings = splitCSVLine(line);
+  }
+
+  while ( std::getline(file, line) ) {
+    std::vector<std::string> fields = splitCSVLine(line);
+    if ( fields.empty() || fields[0].empty() ) {
+      continue;
+    }
+    for (size_t ic = 1; ic < fields.size() &&
+                        ic < variants.size() && ic < tunings.size(); ++ic) {
+      const char* begin = fields[ic].c_str();
+      char* end = nullptr;
+      double time = std::strtod(begin, &end);
+      if ( end == begin ) {
+        continue;  // "Not run"
+      }
+      BaselineResult result;
+      result.kernel = fields[0];
+      result.variant = variants[ic];
+      result.tuning = tunings[ic];
+      result.avg_time = time;
+      result.min_time = time;
+      result.max_time = time;
+      results.push_back(result);
+    }
+  }
+}
+
+}  // closing brace for anonymous namespace
+
+bool readBaselineResults(const std::string& filename,
+                         std::vector<BaselineResult>& results)
+{
+  results.clear();
+
+  std::ifstream file(filename);
+  if ( !file ) {
+    return false;
+  }
+
+  // data files hold one JSON object per line
+  char first = ' ';
+  while ( file.get(first) && std::isspace(static_cast<unsigned char>(first)) ) { }
+  file.unget();
+
+  if ( first == '{' ) {
+    readJSONResults(file, results);
+  } else {
+    readCSVResults(file, results);
+  }
+
+  return !results.empty();
+}
+
+}  // closing brace for rajaperf namespace
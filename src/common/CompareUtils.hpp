@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Utility methods for reading results of previous runs to compare with.
+///
+
+#ifndef RAJAPerf_CompareUtils_HPP
+#define RAJAPerf_CompareUtils_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Result of one kernel variant tuning in a previous run.
+ *
+ * Times are per pass, as in timing reports, and are for the nominal reps
+ * per pass even if adaptive reps ran a different number. Nominal reps and
+ * timing sample statistics are only known for results read from data
+ * files; otherwise reps is zero and sample_count is zero.
+ *
+ *******************************************************************************
+ */
+struct BaselineResult
+{
+  std::string kernel;
+  std::string variant;
+  std::string tuning;
+
+  double avg_time = 0.0;       // sec.
+  double min_time = 0.0;       // sec.
+  double max_time = 0.0;       // sec.
+  double reps = 0.0;
+
+  size_t sample_count = 0;
+  double sample_mean = 0.0;    // sec. per rep
+  double sample_stddev = 0.0;  // sec. per rep
+};
+
+/*!
+ * \brief Read results from data file (*-data.jsonl) or timing file
+ *        (*-timing-<combiner>.csv) written by a previous run.
+ *
+ * Return false if file can't be read or has no results.
+ */
+bool readBaselineResults(const std::string& filename,
+                         std::vector<BaselineResult>& results);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
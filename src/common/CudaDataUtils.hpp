@@ -116,7 +116,7 @@ __device__ inline Index_type lambda_cuda_get_index<RAJA::cuda_block_z_direct>()
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void initCudaDeviceData(T& dptr, const T hptr, int len)
+void initCudaDeviceData(T& dptr, const T hptr, Index_type len)
 {
   cudaErrchk( cudaMemcpy( dptr, hptr,
                           len * sizeof(typename std::remove_pointer<T>::type),
@@ -129,21 +129,27 @@ void initCudaDeviceData(T& dptr, const T hptr, int len)
  * \brief Allocate CUDA device data array (dptr).
  */
 template <typename T>
-void allocCudaDeviceData(T& dptr, int len)
+void allocCudaDeviceData(T& dptr, Index_type len)
 {
   cudaErrchk( cudaMalloc( (void**)&dptr,
               len * sizeof(typename std::remove_pointer<T>::type) ) );
+  detail::recordDataAlloc(dptr,
+                          len * sizeof(typename std::remove_pointer<T>::type),
+                          detail::DataSpace::Device);
 }
 
 /*!
  * \brief Allocate CUDA pinned data array (pptr).
  */
 template <typename T>
-void allocCudaPinnedData(T& pptr, int len)
+void allocCudaPinnedData(T& pptr, Index_type len)
 {
   cudaErrchk( cudaHostAlloc( (void**)&pptr,
               len * sizeof(typename std::remove_pointer<T>::type),
               cudaHostAllocMapped ) );
+  detail::recordDataAlloc(pptr,
+                          len * sizeof(typename std::remove_pointer<T>::type),
+                          detail::DataSpace::Pinned);
 }
 
 /*!
@@ -151,7 +157,7 @@ void allocCudaPinnedData(T& pptr, int len)
  * data to device array.
  */
 template <typename T>
-void allocAndInitCudaDeviceData(T& dptr, const T hptr, int len)
+void allocAndInitCudaDeviceData(T& dptr, const T hptr, Index_type len)
 {
   allocCudaDeviceData(dptr, len);
   initCudaDeviceData(dptr, hptr, len);
@@ -164,7 +170,7 @@ void allocAndInitCudaDeviceData(T& dptr, const T hptr, int len)
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void getCudaDeviceData(T& hptr, const T dptr, int len)
+void getCudaDeviceData(T& hptr, const T dptr, Index_type len)
 {
   cudaErrchk( cudaMemcpy( hptr, dptr,
               len * sizeof(typename std::remove_pointer<T>::type),
@@ -177,6 +183,7 @@ void getCudaDeviceData(T& hptr, const T dptr, int len)
 template <typename T>
 void deallocCudaDeviceData(T& dptr)
 {
+  detail::recordDataDealloc(dptr);
   cudaErrchk( cudaFree( dptr ) );
   dptr = nullptr;
 }
@@ -187,6 +194,7 @@ void deallocCudaDeviceData(T& dptr)
 template <typename T>
 void deallocCudaPinnedData(T& pptr)
 {
+  detail::recordDataDealloc(pptr);
   cudaErrchk( cudaFreeHost( pptr ) );
   pptr = nullptr;
 }
@@ -11,7 +11,24 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/resource.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace rajaperf
 {
@@ -19,7 +36,367 @@ namespace rajaperf
 namespace detail
 {
 
-static int data_init_count = 0;
+// per thread so kernels set up in concurrent threads (co-run) are
+// initialized as when run alone
+static thread_local int data_init_count = 0;
+
+static RunParams::DataInitMode data_init_mode = RunParams::DataInitMode::ParallelInit;
+
+/*
+ * Set how data for OpenMP variants is initialized.
+ */
+void setDataInitMode(RunParams::DataInitMode mode)
+{
+  data_init_mode = mode;
+}
+
+static RunParams::HostMemoryMode host_memory_mode = RunParams::HostMemoryMode::AlignedMemory;
+
+/*
+ * Set how host data arrays are allocated.
+ */
+void setHostMemoryMode(RunParams::HostMemoryMode mode)
+{
+  host_memory_mode = mode;
+}
+
+#if defined(__linux__)
+
+static const size_t huge_page_size = 2*1024*1024;
+
+//
+// Sizes of host allocations made with mmap, needed to unmap them.
+//
+static std::unordered_map<void*, size_t> host_mmap_sizes;
+static std::mutex host_mmap_mutex;
+
+static size_t roundUpBytes(size_t nbytes, size_t multiple)
+{
+  return (nbytes + multiple - 1) / multiple * multiple;
+}
+
+/*
+ * Return mmap'ed anonymous memory of at least given size, or nullptr.
+ */
+static void* mmapHostMemory(size_t nbytes, int flags)
+{
+  void* ptr = mmap(nullptr, nbytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  if ( ptr == MAP_FAILED ) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(host_mmap_mutex);
+  host_mmap_sizes[ptr] = nbytes;
+  return ptr;
+}
+
+#endif
+
+/*
+ * Allocate host memory as given by host memory mode. Memory from mmap is
+ * page aligned, which satisfies any alignment up to the page size.
+ */
+static void* allocHostMemory(size_t nbytes, int align)
+{
+  nbytes = std::max(nbytes, static_cast<size_t>(1));
+
+#if defined(__linux__)
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+
+  if ( host_memory_mode == RunParams::HostMemoryMode::HugeTLBMemory &&
+       static_cast<size_t>(align) <= huge_page_size ) {
+    void* ptr = mmapHostMemory(roundUpBytes(nbytes, huge_page_size),
+                               MAP_HUGETLB);
+    if ( ptr ) {
+      return ptr;
+    }
+    static bool warned = false;
+    if ( !warned ) {
+      getCout() << "\n Can't allocate explicit huge pages,"
+                << " using transparent huge pages" << std::endl;
+      warned = true;
+    }
+  }
+
+  if ( host_memory_mode == RunParams::HostMemoryMode::HugeTLBMemory ||
+       host_memory_mode == RunParams::HostMemoryMode::THPMemory ) {
+    size_t thp_bytes = roundUpBytes(nbytes, huge_page_size);
+    void* ptr = RAJA::allocate_aligned_type<char>(
+        std::max(static_cast<size_t>(align), huge_page_size), thp_bytes);
+    if ( ptr ) {
+      madvise(ptr, thp_bytes, MADV_HUGEPAGE);
+    }
+    return ptr;
+  }
+
+  if ( host_memory_mode == RunParams::HostMemoryMode::PopulateMemory &&
+       static_cast<size_t>(align) <= page_size ) {
+    void* ptr = mmapHostMemory(roundUpBytes(nbytes, page_size),
+                               MAP_POPULATE);
+    if ( ptr ) {
+      return ptr;
+    }
+  }
+#endif
+
+  return RAJA::allocate_aligned_type<char>(align, nbytes);
+}
+
+/*
+ * Free host memory allocated with allocHostMemory.
+ */
+static void freeHostMemory(void* ptr)
+{
+#if defined(__linux__)
+  size_t mmap_bytes = 0;
+  {
+    std::lock_guard<std::mutex> lock(host_mmap_mutex);
+    auto mmap_iter = host_mmap_sizes.find(ptr);
+    if ( mmap_iter != host_mmap_sizes.end() ) {
+      mmap_bytes = mmap_iter->second;
+      host_mmap_sizes.erase(mmap_iter);
+    }
+  }
+  if ( mmap_bytes > 0 ) {
+    munmap(ptr, mmap_bytes);
+    return;
+  }
+#endif
+
+  RAJA::free_aligned(static_cast<char*>(ptr));
+}
+
+/*
+ * Allocate host memory for a kernel data array and count it.
+ */
+static void* allocHostData(size_t nbytes, int align)
+{
+  void* ptr = allocHostMemory(nbytes, align);
+  recordDataAlloc(ptr, nbytes, DataSpace::Host);
+  return ptr;
+}
+
+/*
+ * Return true if data for given variant is first touched and initialized
+ * in parallel.
+ */
+static bool useParallelInit(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  return data_init_mode == RunParams::DataInitMode::ParallelInit &&
+         ( vid == Base_OpenMP ||
+           vid == Lambda_OpenMP ||
+           vid == RAJA_OpenMP );
+#else
+  (void) vid;
+  return false;
+#endif
+}
+
+//
+// Host data arrays kept between runs of one kernel when data caching is on.
+// Arrays are matched by type, length, alignment, how and when (data init
+// count) they are initialized, and whether they are initialized in
+// parallel, so a match holds the same values a new array would have. Only
+// a signature of initialized values is kept, so caching takes no extra
+// memory; arrays whose signature changed while a kernel used them are
+// initialized again, and constant initialized (output) arrays are just
+// filled again.
+//
+enum struct CachedInit { NoInit, Init, InitConst, InitRandSign, InitRandValue };
+
+struct CachedData
+{
+  void* ptr;
+  uint64_t signature;
+  bool modified;
+  const std::type_info* type;
+  Index_type len;
+  size_t nbytes;
+  int align;
+  CachedInit init;
+  Real_type val;
+  int init_count;
+  bool parallel_init;
+  bool in_use;
+};
+
+static bool data_cache_enabled = false;
+static KernelID data_cache_kernel = NumKernels;
+static std::vector<CachedData> data_cache;
+
+/*
+ * Return signature of host memory, used to tell whether a cached array
+ * was modified after it was initialized. Words are mixed with their index
+ * and summed, so the signature does not depend on the number of threads.
+ */
+static uint64_t getHostMemorySignature(const void* ptr, size_t nbytes,
+                                       bool parallel_init)
+{
+  auto mix = [](uint64_t x) {
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27; x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+  };
+
+  const char* bytes = static_cast<const char*>(ptr);
+  const Index_type nwords = nbytes / sizeof(uint64_t);
+  uint64_t signature = 0;
+
+  (void) parallel_init;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static) reduction(+:signature) if(parallel_init)
+#endif
+  for (Index_type i = 0; i < nwords; ++i) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i*sizeof(uint64_t), sizeof(uint64_t));
+    signature += mix(word + i*0x9e3779b97f4a7c15ull);
+  }
+  for (size_t b = nwords*sizeof(uint64_t); b < nbytes; ++b) {
+    signature += mix(static_cast<unsigned char>(bytes[b]) +
+                     b*0x9e3779b97f4a7c15ull);
+  }
+
+  return signature;
+}
+
+/*
+ * Turn host data caching on or off.
+ */
+void setDataCache(bool enable)
+{
+  releaseDataCache();
+  data_cache_enabled = enable;
+}
+
+/*
+ * Cache host data for given kernel, releasing data cached for any other.
+ */
+void setDataCacheKernel(KernelID kid)
+{
+  if ( kid != data_cache_kernel ) {
+    releaseDataCache();
+    data_cache_kernel = kid;
+  }
+}
+
+/*
+ * Free all cached host data that is not in use.
+ */
+void releaseDataCache()
+{
+  for (CachedData& entry : data_cache) {
+    if ( !entry.in_use ) {
+      freeHostMemory(entry.ptr);
+      entry.ptr = nullptr;
+    }
+  }
+  data_cache.erase(std::remove_if(data_cache.begin(), data_cache.end(),
+                                  [](const CachedData& entry) {
+                                    return entry.ptr == nullptr;
+                                  }),
+                   data_cache.end());
+  data_cache_kernel = NumKernels;
+}
+
+/*
+ * Get unused cached array matching given arguments and the current data
+ * init count, and set modified if a kernel changed its initialized values
+ * so the caller must initialize it again. Return false if caching is off
+ * or there is no match.
+ */
+template < typename T >
+static bool getCachedData(T*& ptr, Index_type len, int align,
+                          CachedInit init, Real_type val, VariantID vid,
+                          bool& modified)
+{
+  modified = false;
+
+  if ( !data_cache_enabled ) {
+    return false;
+  }
+
+  const bool parallel_init = useParallelInit(vid);
+
+  for (CachedData& entry : data_cache) {
+    if ( !entry.in_use &&
+         *entry.type == typeid(T) &&
+         entry.len == len &&
+         entry.align == align &&
+         entry.init == init &&
+         entry.val == val &&
+         entry.init_count == data_init_count &&
+         entry.parallel_init == parallel_init ) {
+      modified = entry.modified;
+      entry.modified = false;
+      entry.in_use = true;
+      ptr = static_cast<T*>(entry.ptr);
+      recordDataAlloc(entry.ptr, entry.nbytes, DataSpace::Host);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Add array to cache, in use, with a signature of its values if it was
+ * initialized with values other than a constant. The init count is its
+ * value before the array was initialized.
+ */
+template < typename T >
+static void putCachedData(T* ptr, Index_type len, int align,
+                          CachedInit init, Real_type val, int init_count,
+                          VariantID vid)
+{
+  if ( !data_cache_enabled ) {
+    return;
+  }
+
+  CachedData entry;
+  entry.ptr = ptr;
+  entry.signature = 0;
+  entry.modified = false;
+  entry.type = &typeid(T);
+  entry.len = len;
+  entry.nbytes = len*sizeof(T);
+  entry.align = align;
+  entry.init = init;
+  entry.val = val;
+  entry.init_count = init_count;
+  entry.parallel_init = useParallelInit(vid);
+  entry.in_use = true;
+
+  if ( init != CachedInit::NoInit && init != CachedInit::InitConst ) {
+    entry.signature = getHostMemorySignature(ptr, entry.nbytes,
+                                             entry.parallel_init);
+  }
+
+  data_cache.push_back(entry);
+}
+
+/*
+ * Return array to cache if it is cached, noting whether its initialized
+ * values were modified; return false if not cached.
+ */
+static bool returnCachedData(void* ptr)
+{
+  for (CachedData& entry : data_cache) {
+    if ( entry.in_use && entry.ptr == ptr ) {
+      if ( entry.init != CachedInit::NoInit &&
+           entry.init != CachedInit::InitConst ) {
+        entry.modified = ( getHostMemorySignature(ptr, entry.nbytes,
+                                                  entry.parallel_init) !=
+                           entry.signature );
+      }
+      entry.in_use = false;
+      return true;
+    }
+  }
+  return false;
+}
+
 
 /*
  * Reset counter for data initialization.
@@ -38,72 +415,247 @@ void incDataInitCount()
 }
 
 
+static const std::string data_space_names[] = {
+  std::string("Host"),
+  std::string("Pinned"),
+  std::string("Device"),
+
+  std::string("Unknown Space")  // Keep this at the end and DO NOT remove....
+};
+
+/*
+ * Return name of given data space.
+ */
+const std::string& getDataSpaceName(DataSpace space)
+{
+  return data_space_names[static_cast<size_t>(space)];
+}
+
+//
+// Footprint each counted allocation is charged to, with its space and
+// size, so frees are charged to the same footprint. Kernels set up in
+// concurrent threads (co-run) each count against their own footprint.
+//
+struct DataAllocRecord
+{
+  DataFootprint* footprint;
+  DataSpace space;
+  size_t nbytes;
+};
+
+static thread_local DataFootprint* data_footprint = nullptr;
+static std::unordered_map<const void*, DataAllocRecord> data_alloc_records;
+static std::mutex data_alloc_mutex;
+
+/*
+ * Count data allocated in calling thread against given footprint.
+ */
+void setDataFootprint(DataFootprint* footprint)
+{
+  data_footprint = footprint;
+}
+
+/*
+ * Count allocation against footprint of calling thread, if it has one.
+ */
+void recordDataAlloc(const void* ptr, size_t nbytes, DataSpace space)
+{
+  if ( !ptr || !data_footprint ) {
+    return;
+  }
+  const size_t ispace = static_cast<size_t>(space);
+
+  std::lock_guard<std::mutex> lock(data_alloc_mutex);
+  data_alloc_records[ptr] = DataAllocRecord{data_footprint, space, nbytes};
+  data_footprint->current_bytes[ispace] += nbytes;
+  data_footprint->high_water_bytes[ispace] =
+      std::max(data_footprint->high_water_bytes[ispace],
+               data_footprint->current_bytes[ispace]);
+}
+
+/*
+ * Count deallocation against footprint its allocation was counted in.
+ */
+void recordDataDealloc(const void* ptr)
+{
+  std::lock_guard<std::mutex> lock(data_alloc_mutex);
+  auto record_iter = data_alloc_records.find(ptr);
+  if ( record_iter == data_alloc_records.end() ) {
+    return;
+  }
+  const DataAllocRecord& record = record_iter->second;
+  record.footprint->current_bytes[static_cast<size_t>(record.space)] -=
+      record.nbytes;
+  data_alloc_records.erase(record_iter);
+}
+
+/*
+ * Return peak resident set size of this process.
+ */
+size_t getPeakRSSBytes()
+{
+  struct rusage usage;
+  if ( getrusage(RUSAGE_SELF, &usage) != 0 ) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  // bytes on macOS
+  return static_cast<size_t>(usage.ru_maxrss);
+#else
+  // kilobytes on Linux
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+
 /*
  * Allocate and initialize aligned data arrays.
  */
-void allocAndInitData(Int_ptr& ptr, int len, int align, VariantID vid)
+void allocAndInitData(Int_ptr& ptr, Index_type len, int align, VariantID vid)
 {
-  allocData(ptr, len, align, vid);
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::Init, 0.0, vid, modified) ) {
+    if ( modified ) {
+      initData(ptr, len, vid);
+    } else {
+      incDataInitCount();
+    }
+    return;
+  }
+  const int init_count = data_init_count;
+  ptr = static_cast<Int_ptr>(allocHostData(len*sizeof(Int_type), align));
   initData(ptr, len, vid);
+  putCachedData(ptr, len, align, CachedInit::Init, 0.0, init_count, vid);
 }
 
-void allocAndInitData(Real_ptr& ptr, int len, int align, VariantID vid )
+void allocAndInitData(Real_ptr& ptr, Index_type len, int align, VariantID vid )
 {
-  allocData(ptr, len, align, vid);
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::Init, 0.0, vid, modified) ) {
+    if ( modified ) {
+      initData(ptr, len, vid);
+    } else {
+      incDataInitCount();
+    }
+    return;
+  }
+  const int init_count = data_init_count;
+  ptr = static_cast<Real_ptr>(allocHostData(len*sizeof(Real_type), align));
   initData(ptr, len, vid);
+  putCachedData(ptr, len, align, CachedInit::Init, 0.0, init_count, vid);
 }
 
-void allocAndInitDataConst(Real_ptr& ptr, int len, int align, Real_type val,
+void allocAndInitDataConst(Real_ptr& ptr, Index_type len, int align, Real_type val,
                            VariantID vid)
 {
-  allocData(ptr, len, align, vid);
+  const int init_count = data_init_count;
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::InitConst, val, vid, modified) ) {
+    initDataConst(ptr, len, val, vid);
+    return;
+  }
+  ptr = static_cast<Real_ptr>(allocHostData(len*sizeof(Real_type), align));
   initDataConst(ptr, len, val, vid);
+  putCachedData(ptr, len, align, CachedInit::InitConst, val, init_count, vid);
 }
 
-void allocAndInitDataRandSign(Real_ptr& ptr, int len, int align, VariantID vid)
+void allocAndInitDataRandSign(Real_ptr& ptr, Index_type len, int align, VariantID vid)
 {
-  allocData(ptr, len, align, vid);
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::InitRandSign, 0.0, vid, modified) ) {
+    if ( modified ) {
+      initDataRandSign(ptr, len, vid);
+    } else {
+      incDataInitCount();
+    }
+    return;
+  }
+  const int init_count = data_init_count;
+  ptr = static_cast<Real_ptr>(allocHostData(len*sizeof(Real_type), align));
   initDataRandSign(ptr, len, vid);
+  putCachedData(ptr, len, align, CachedInit::InitRandSign, 0.0, init_count, vid);
 }
 
-void allocAndInitDataRandValue(Real_ptr& ptr, int len, int align, VariantID vid)
+void allocAndInitDataRandValue(Real_ptr& ptr, Index_type len, int align, VariantID vid)
 {
-  allocData(ptr, len, align, vid);
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::InitRandValue, 0.0, vid, modified) ) {
+    if ( modified ) {
+      initDataRandValue(ptr, len, vid);
+    } else {
+      incDataInitCount();
+    }
+    return;
+  }
+  const int init_count = data_init_count;
+  ptr = static_cast<Real_ptr>(allocHostData(len*sizeof(Real_type), align));
   initDataRandValue(ptr, len, vid);
+  putCachedData(ptr, len, align, CachedInit::InitRandValue, 0.0, init_count, vid);
 }
 
-void allocAndInitData(Complex_ptr& ptr, int len, int align, VariantID vid)
+void allocAndInitData(Complex_ptr& ptr, Index_type len, int align, VariantID vid)
 {
-  allocData(ptr, len, align, vid);
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::Init, 0.0, vid, modified) ) {
+    if ( modified ) {
+      initData(ptr, len, vid);
+    } else {
+      incDataInitCount();
+    }
+    return;
+  }
+  const int init_count = data_init_count;
+  ptr = static_cast<Complex_ptr>(allocHostData(len*sizeof(Complex_type), align));
   initData(ptr, len, vid);
+  putCachedData(ptr, len, align, CachedInit::Init, 0.0, init_count, vid);
 }
 
 
 /*
  * Allocate data arrays of given type.
  */
-void allocData(Int_ptr& ptr, int len, int align,
+void allocData(Int_ptr& ptr, Index_type len, int align,
                VariantID vid)
 {
-  (void)vid;
-  ptr = RAJA::allocate_aligned_type<Int_type>(
-      align, len*sizeof(Int_type));
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::NoInit, 0.0, vid, modified) ) {
+    return;
+  }
+  ptr = static_cast<Int_ptr>(allocHostData(len*sizeof(Int_type), align));
+  putCachedData(ptr, len, align, CachedInit::NoInit, 0.0, data_init_count, vid);
 }
 
-void allocData(Real_ptr& ptr, int len, int align,
+void allocData(Index_ptr& ptr, Index_type len, int align,
                VariantID vid)
 {
-  (void)vid;
-  ptr = RAJA::allocate_aligned_type<Real_type>(
-      align, len*sizeof(Real_type));
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::NoInit, 0.0, vid, modified) ) {
+    return;
+  }
+  ptr = static_cast<Index_ptr>(allocHostData(len*sizeof(Index_type), align));
+  putCachedData(ptr, len, align, CachedInit::NoInit, 0.0, data_init_count, vid);
 }
 
-void allocData(Complex_ptr& ptr, int len, int align,
+void allocData(Real_ptr& ptr, Index_type len, int align,
                VariantID vid)
 {
-  (void)vid;
-  ptr = RAJA::allocate_aligned_type<Complex_type>(
-      align, len*sizeof(Complex_type));
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::NoInit, 0.0, vid, modified) ) {
+    return;
+  }
+  ptr = static_cast<Real_ptr>(allocHostData(len*sizeof(Real_type), align));
+  putCachedData(ptr, len, align, CachedInit::NoInit, 0.0, data_init_count, vid);
+}
+
+void allocData(Complex_ptr& ptr, Index_type len, int align,
+               VariantID vid)
+{
+  bool modified = false;
+  if ( getCachedData(ptr, len, align, CachedInit::NoInit, 0.0, vid, modified) ) {
+    return;
+  }
+  ptr = static_cast<Complex_ptr>(allocHostData(len*sizeof(Complex_type), align));
+  putCachedData(ptr, len, align, CachedInit::NoInit, 0.0, data_init_count, vid);
 }
 
 
@@ -115,7 +667,23 @@ void deallocData(Int_ptr& ptr,
 {
   (void)vid;
   if (ptr) {
-    RAJA::free_aligned(ptr);
+    recordDataDealloc(ptr);
+    if ( !returnCachedData(ptr) ) {
+      freeHostMemory(ptr);
+    }
+    ptr = nullptr;
+  }
+}
+
+void deallocData(Index_ptr& ptr,
+                 VariantID vid)
+{
+  (void)vid;
+  if (ptr) {
+    recordDataDealloc(ptr);
+    if ( !returnCachedData(ptr) ) {
+      freeHostMemory(ptr);
+    }
     ptr = nullptr;
   }
 }
@@ -125,7 +693,10 @@ void deallocData(Real_ptr& ptr,
 {
   (void)vid;
   if (ptr) {
-    RAJA::free_aligned(ptr);
+    recordDataDealloc(ptr);
+    if ( !returnCachedData(ptr) ) {
+      freeHostMemory(ptr);
+    }
     ptr = nullptr;
   }
 }
@@ -135,7 +706,10 @@ void deallocData(Complex_ptr& ptr,
 {
   (void)vid;
   if (ptr) {
-    RAJA::free_aligned(ptr);
+    recordDataDealloc(ptr);
+    if ( !returnCachedData(ptr) ) {
+      freeHostMemory(ptr);
+    }
     ptr = nullptr;
   }
 }
@@ -145,37 +719,33 @@ void deallocData(Complex_ptr& ptr,
  * \brief Initialize Int_type data array to
  * randomly signed positive and negative values.
  */
-void initData(Int_ptr& ptr, int len, VariantID vid)
+void initData(Int_ptr& ptr, Index_type len, VariantID vid)
 {
-  (void) vid;
-
 // First touch...
+  if ( useParallelInit(vid) ) {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
+    #pragma omp parallel for schedule(static)
+#endif
+    for (Index_type i = 0; i < len; ++i) {
       ptr[i] = 0;
     };
   }
-#endif
 
   srand(4793);
 
   Real_type signfact = 0.0;
 
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     signfact = Real_type(rand())/RAND_MAX;
     ptr[i] = ( signfact < 0.5 ? -1 : 1 );
   };
 
   signfact = Real_type(rand())/RAND_MAX;
-  Int_type ilo = len * signfact;
+  Index_type ilo = len * signfact;
   ptr[ilo] = -58;
 
   signfact = Real_type(rand())/RAND_MAX;
-  Int_type ihi = len * signfact;
+  Index_type ihi = len * signfact;
   ptr[ihi] = 19;
 
   incDataInitCount();
@@ -186,25 +756,17 @@ void initData(Int_ptr& ptr, int len, VariantID vid)
  * positive values (0.0, 1.0) based on their array position
  * (index) and the order in which this method is called.
  */
-void initData(Real_ptr& ptr, int len, VariantID vid)
+void initData(Real_ptr& ptr, Index_type len, VariantID vid)
 {
-  (void) vid;
-
   Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
-// first touch...
+  const bool parallel_init = useParallelInit(vid);
+  (void) parallel_init;
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  }
+  #pragma omp parallel for schedule(static) if(parallel_init)
 #endif
-
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     ptr[i] = factor*(i + 1.1)/(i + 1.12345);
   }
 
@@ -214,25 +776,16 @@ void initData(Real_ptr& ptr, int len, VariantID vid)
 /*
  * Initialize Real_type data array to constant values.
  */
-void initDataConst(Real_ptr& ptr, int len, Real_type val,
+void initDataConst(Real_ptr& ptr, Index_type len, Real_type val,
                    VariantID vid)
 {
+  const bool parallel_init = useParallelInit(vid);
+  (void) parallel_init;
 
-// first touch...
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0;
-    };
-  }
-#else
-  (void) vid;
+  #pragma omp parallel for schedule(static) if(parallel_init)
 #endif
-
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     ptr[i] = val;
   };
 
@@ -242,27 +795,23 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
 /*
  * Initialize Real_type data array with random sign.
  */
-void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
+void initDataRandSign(Real_ptr& ptr, Index_type len, VariantID vid)
 {
-  (void) vid;
-
 // First touch...
+  if ( useParallelInit(vid) ) {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
+    #pragma omp parallel for schedule(static)
+#endif
+    for (Index_type i = 0; i < len; ++i) {
       ptr[i] = 0.0;
     };
   }
-#endif
 
   Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
 
   srand(4793);
 
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     Real_type signfact = Real_type(rand())/RAND_MAX;
     signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
     ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
@@ -274,25 +823,21 @@ void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
 /*
  * Initialize Real_type data array with random values.
  */
-void initDataRandValue(Real_ptr& ptr, int len, VariantID vid)
+void initDataRandValue(Real_ptr& ptr, Index_type len, VariantID vid)
 {
-  (void) vid;
-
 // First touch...
+  if ( useParallelInit(vid) ) {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
+    #pragma omp parallel for schedule(static)
+#endif
+    for (Index_type i = 0; i < len; ++i) {
       ptr[i] = 0.0;
     };
   }
-#endif
 
   srand(4793);
 
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     ptr[i] = Real_type(rand())/RAND_MAX;
   };
 
@@ -302,25 +847,18 @@ void initDataRandValue(Real_ptr& ptr, int len, VariantID vid)
 /*
  * Initialize Complex_type data array.
  */
-void initData(Complex_ptr& ptr, int len, VariantID vid)
+void initData(Complex_ptr& ptr, Index_type len, VariantID vid)
 {
-  (void) vid;
-
   Complex_type factor = ( data_init_count % 2 ?  Complex_type(0.1,0.2) :
                                                  Complex_type(0.2,0.3) );
 
+  const bool parallel_init = useParallelInit(vid);
+  (void) parallel_init;
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  }
+  #pragma omp parallel for schedule(static) if(parallel_init)
 #endif
-
-  for (int i = 0; i < len; ++i) {
+  for (Index_type i = 0; i < len; ++i) {
     ptr[i] = factor*(i + 1.1)/(i + 1.12345);
   }
 
@@ -342,73 +880,124 @@ void initData(Real_type& d, VariantID vid)
 
 }  // closing brace for detail namespace
 
+namespace
+{
+
+//
+// Checksums sum fixed size blocks of weighted entries, each in a fixed
+// number of lanes, and combine block sums in order. So results do not
+// depend on number of threads used.
+//
+const Index_type checksum_block_size = 1024;
+const Index_type checksum_num_lanes = 8;
+
+//
+// sin and cos of entry offsets in a block, computed once. With sin and cos
+// of the first entry of a block, angle addition gives weights
+// |sin(j+1)| + 0.5 of all its entries, so checksums make two sin/cos calls
+// per block instead of one per entry.
+//
+struct ChecksumOffsetTrig
+{
+  long double sin_k[checksum_block_size];
+  long double cos_k[checksum_block_size];
+};
+
+const ChecksumOffsetTrig& getChecksumOffsetTrig()
+{
+  static const ChecksumOffsetTrig trig = []() {
+    ChecksumOffsetTrig t;
+    for (Index_type k = 0; k < checksum_block_size; ++k) {
+      t.sin_k[k] = std::sin(static_cast<long double>(k));
+      t.cos_k[k] = std::cos(static_cast<long double>(k));
+    }
+    return t;
+  }();
+  return trig;
+}
+
 /*
- * Calculate and return checksum for data arrays.
+ * Return checksum of given number of entries, where value(j) returns
+ * value of entry j.
  */
-long double calcChecksum(const Int_ptr ptr, int len,
-                         Real_type scale_factor)
+template < typename ValueFunc >
+long double calcChecksumImpl(Index_type len, Real_type scale_factor,
+                             ValueFunc&& value)
 {
+  if ( len <= 0 ) {
+    return 0.0;
+  }
+
+  const ChecksumOffsetTrig& trig = getChecksumOffsetTrig();
+
+  const Index_type num_blocks =
+      (len + checksum_block_size - 1) / checksum_block_size;
+  std::vector<long double> block_sums(num_blocks);
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static)
+#endif
+  for (Index_type ib = 0; ib < num_blocks; ++ib) {
+    const Index_type jbegin = ib * checksum_block_size;
+    const Index_type jend = std::min(jbegin + checksum_block_size, len);
+
+    const long double sin_begin = std::sin(static_cast<long double>(jbegin+1));
+    const long double cos_begin = std::cos(static_cast<long double>(jbegin+1));
+
+    long double lanes[checksum_num_lanes] = { };
+    for (Index_type j = jbegin; j < jend; ++j) {
+      const Index_type k = j - jbegin;
+      const long double w = std::abs(sin_begin*trig.cos_k[k] +
+                                     cos_begin*trig.sin_k[k]) + 0.5L;
+      lanes[k % checksum_num_lanes] += w * value(j);
+    }
+
+    // combine lanes pairwise in fixed order
+    for (Index_type stride = 1; stride < checksum_num_lanes; stride *= 2) {
+      for (Index_type k = 0; k < checksum_num_lanes; k += 2*stride) {
+        lanes[k] += lanes[k+stride];
+      }
+    }
+    block_sums[ib] = lanes[0];
+  }
+
   long double tchk = 0.0;
   long double ckahan = 0.0;
-  for (Index_type j = 0; j < len; ++j) {
-    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
-    long double y = x - ckahan;
+  for (Index_type ib = 0; ib < num_blocks; ++ib) {
+    long double y = block_sums[ib] - ckahan;
     volatile long double t = tchk + y;
     volatile long double z = t - tchk;
     ckahan = z - y;
     tchk = t;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
-#endif
   }
   tchk *= scale_factor;
   return tchk;
 }
 
-long double calcChecksum(const Real_ptr ptr, int len,
+}  // closing brace for unnamed namespace
+
+/*
+ * Calculate and return checksum for data arrays.
+ */
+long double calcChecksum(const Int_ptr ptr, Index_type len,
                          Real_type scale_factor)
 {
-  long double tchk = 0.0;
-  long double ckahan = 0.0;
-  for (Index_type j = 0; j < len; ++j) {
-    long double x = (std::abs(std::sin(j+1.0))+0.5) * ptr[j];
-    long double y = x - ckahan;
-    volatile long double t = tchk + y;
-    volatile long double z = t - tchk;
-    ckahan = z - y;
-    tchk = t;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
-#endif
-  }
-  tchk *= scale_factor;
-  return tchk;
+  return calcChecksumImpl(len, scale_factor,
+      [=](Index_type j) { return static_cast<Real_type>(ptr[j]); });
 }
 
-long double calcChecksum(const Complex_ptr ptr, int len,
+long double calcChecksum(const Real_ptr ptr, Index_type len,
                          Real_type scale_factor)
 {
-  long double tchk = 0.0;
-  long double ckahan = 0.0;
-  for (Index_type j = 0; j < len; ++j) {
-    long double x = (std::abs(std::sin(j+1.0))+0.5) * (real(ptr[j])+imag(ptr[j]));
-    long double y = x - ckahan;
-    volatile long double t = tchk + y;
-    volatile long double z = t - tchk;
-    ckahan = z - y;
-    tchk = t;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
-#endif
-  }
-  tchk *= scale_factor;
-  return tchk;
+  return calcChecksumImpl(len, scale_factor,
+      [=](Index_type j) { return ptr[j]; });
+}
+
+long double calcChecksum(const Complex_ptr ptr, Index_type len,
+                         Real_type scale_factor)
+{
+  return calcChecksumImpl(len, scale_factor,
+      [=](Index_type j) { return Real_type(real(ptr[j])+imag(ptr[j])); });
 }
 
 }  // closing brace for rajaperf namespace
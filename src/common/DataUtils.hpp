@@ -16,9 +16,12 @@
 
 #include "RAJAPerfSuite.hpp"
 #include "RPTypes.hpp"
+#include "RunParams.hpp"
 
+#include <cstddef>
 #include <limits>
 #include <new>
+#include <string>
 #include <type_traits>
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -34,6 +37,36 @@ namespace rajaperf
 namespace detail
 {
 
+/*!
+ * Set how data for OpenMP variants is initialized.
+ */
+void setDataInitMode(RunParams::DataInitMode mode);
+
+/*!
+ * Set how host data arrays are allocated.
+ */
+void setHostMemoryMode(RunParams::HostMemoryMode mode);
+
+/*!
+ * Turn caching of host data between kernel runs on or off.
+ *
+ * When on, host arrays freed with deallocData are kept and handed back by
+ * later allocData calls for the same kernel with the same type, length,
+ * alignment, and initialization, restored to their initialized values.
+ */
+void setDataCache(bool enable);
+
+/*!
+ * Cache host data for given kernel; data cached for another kernel is
+ * released.
+ */
+void setDataCacheKernel(KernelID kid);
+
+/*!
+ * Free host data held in cache.
+ */
+void releaseDataCache();
+
 /*!
  * Reset counter for data initialization.
  */
@@ -44,13 +77,67 @@ void resetDataInitCount();
  */
 void incDataInitCount();
 
+/*!
+ * Memory spaces in which kernel data is allocated.
+ */
+enum struct DataSpace {
+  Host = 0,
+  Pinned,
+  Device,
+
+  NumSpaces // Keep this one last and NEVER comment it out (!!)
+};
+
+/*!
+ * Return name of given data space.
+ */
+const std::string& getDataSpaceName(DataSpace space);
+
+/*!
+ * Bytes of data a kernel has allocated and not yet freed, and most bytes
+ * it has held at once, in each data space.
+ */
+struct DataFootprint
+{
+  size_t current_bytes[static_cast<size_t>(DataSpace::NumSpaces)] = { };
+  size_t high_water_bytes[static_cast<size_t>(DataSpace::NumSpaces)] = { };
+
+  size_t getCurrentBytes(DataSpace space) const
+  { return current_bytes[static_cast<size_t>(space)]; }
+  size_t getHighWaterBytes(DataSpace space) const
+  { return high_water_bytes[static_cast<size_t>(space)]; }
+};
+
+/*!
+ * Count data allocated in calling thread against given footprint until it
+ * is set again; nullptr stops counting. Data is counted against the
+ * footprint it was allocated with when freed, in any thread.
+ */
+void setDataFootprint(DataFootprint* footprint);
+
+/*!
+ * Count allocation of given size in given data space.
+ */
+void recordDataAlloc(const void* ptr, size_t nbytes, DataSpace space);
+
+/*!
+ * Count deallocation of given pointer; ignored if its allocation was not
+ * counted.
+ */
+void recordDataDealloc(const void* ptr);
+
+/*!
+ * Return peak resident set size (bytes) of this process.
+ */
+size_t getPeakRSSBytes();
+
 
 /*!
  * \brief Allocate and initialize Int_type data array.
  *
  * Array is initialized using method initData(Int_ptr& ptr...) below.
  */
-void allocAndInitData(Int_ptr& ptr, int len, int align,
+void allocAndInitData(Int_ptr& ptr, Index_type len, int align,
                       VariantID vid);
 
 /*!
@@ -58,7 +145,7 @@ void allocAndInitData(Int_ptr& ptr, int len, int align,
  *
  * Array is initialized using method initData(Real_ptr& ptr...) below.
  */
-void allocAndInitData(Real_ptr& ptr, int len, int align,
+void allocAndInitData(Real_ptr& ptr, Index_type len, int align,
                       VariantID vid);
 
 /*!
@@ -67,7 +154,7 @@ void allocAndInitData(Real_ptr& ptr, int len, int align,
  * Array entries are initialized using the method
  * initDataConst(Real_ptr& ptr...) below.
  */
-void allocAndInitDataConst(Real_ptr& ptr, int len, int align, Real_type val,
+void allocAndInitDataConst(Real_ptr& ptr, Index_type len, int align, Real_type val,
                            VariantID vid);
 
 /*!
@@ -75,7 +162,7 @@ void allocAndInitDataConst(Real_ptr& ptr, int len, int align, Real_type val,
  *
  * Array is initialized using method initDataRandSign(Real_ptr& ptr...) below.
  */
-void allocAndInitDataRandSign(Real_ptr& ptr, int len, int align,
+void allocAndInitDataRandSign(Real_ptr& ptr, Index_type len, int align,
                               VariantID vid);
 
 /*!
@@ -84,25 +171,28 @@ void allocAndInitDataRandSign(Real_ptr& ptr, int len, int align,
  *
  * Array is initialized using method initDataRandValue(Real_ptr& ptr...) below.
  */
-void allocAndInitDataRandValue(Real_ptr& ptr, int len, int align,
+void allocAndInitDataRandValue(Real_ptr& ptr, Index_type len, int align,
                                VariantID vid);
 
 /*!
  * \brief Allocate and initialize aligned Complex_type data array.
  */
-void allocAndInitData(Complex_ptr& ptr, int len, int align,
+void allocAndInitData(Complex_ptr& ptr, Index_type len, int align,
                       VariantID vid);
 
 /*!
  * \brief Allocate data arrays.
  */
-void allocData(Int_ptr& ptr, int len, int align,
+void allocData(Int_ptr& ptr, Index_type len, int align,
                VariantID vid);
 ///
-void allocData(Real_ptr& ptr, int len, int align,
+void allocData(Index_ptr& ptr, Index_type len, int align,
                VariantID vid);
 ///
-void allocData(Complex_ptr& ptr, int len, int align,
+void allocData(Real_ptr& ptr, Index_type len, int align,
+               VariantID vid);
+///
+void allocData(Complex_ptr& ptr, Index_type len, int align,
                VariantID vid);
 
 /*!
@@ -111,6 +201,9 @@ void allocData(Complex_ptr& ptr, int len, int align,
 void deallocData(Int_ptr& ptr,
                  VariantID vid);
 ///
+void deallocData(Index_ptr& ptr,
+                 VariantID vid);
+///
 void deallocData(Real_ptr& ptr,
                  VariantID vid);
 ///
@@ -125,7 +218,7 @@ void deallocData(Complex_ptr& ptr,
  * Then, two randomly-chosen entries are reset, one to
  * a value > 1, one to a value < -1.
  */
-void initData(Int_ptr& ptr, int len,
+void initData(Int_ptr& ptr, Index_type len,
               VariantID vid);
 
 /*!
@@ -135,7 +228,7 @@ void initData(Int_ptr& ptr, int len,
  * in the interval (0.0, 1.0) based on their array position (index)
  * and the order in which this method is called.
  */
-void initData(Real_ptr& ptr, int len,
+void initData(Real_ptr& ptr, Index_type len,
               VariantID vid);
 
 /*!
@@ -143,7 +236,7 @@ void initData(Real_ptr& ptr, int len,
  *
  * Array entries are set to given constant value.
  */
-void initDataConst(Real_ptr& ptr, int len, Real_type val,
+void initDataConst(Real_ptr& ptr, Index_type len, Real_type val,
                    VariantID vid);
 
 /*!
@@ -152,7 +245,7 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
  * Array entries are initialized in the same way as the method
  * initData(Real_ptr& ptr...) above, but with random sign.
  */
-void initDataRandSign(Real_ptr& ptr, int len,
+void initDataRandSign(Real_ptr& ptr, Index_type len,
                       VariantID vid);
 
 /*!
@@ -160,7 +253,7 @@ void initDataRandSign(Real_ptr& ptr, int len,
  *
  * Array entries are initialized with random values in the interval [0.0, 1.0].
  */
-void initDataRandValue(Real_ptr& ptr, int len,
+void initDataRandValue(Real_ptr& ptr, Index_type len,
                        VariantID vid);
 
 /*!
@@ -169,7 +262,7 @@ void initDataRandValue(Real_ptr& ptr, int len,
  * Real and imaginary array entries are initialized in the same way as the
  * method allocAndInitData(Real_ptr& ptr...) above.
  */
-void initData(Complex_ptr& ptr, int len,
+void initData(Complex_ptr& ptr, Index_type len,
               VariantID vid);
 
 /*!
@@ -189,15 +282,19 @@ void initData(Real_type& d,
  * Checksums are computed as a weighted sum of array entries,
  * where weight is a simple function of elemtn index.
  *
+ * Entries are summed in fixed size blocks (in parallel when OpenMP is
+ * enabled) and block sums are combined in order, so checksums do not
+ * depend on the number of threads used.
+ *
  * Checksumn is multiplied by given scale factor.
  */
-long double calcChecksum(Int_ptr d, int len,
+long double calcChecksum(Int_ptr d, Index_type len,
                          Real_type scale_factor = 1.0);
 ///
-long double calcChecksum(Real_ptr d, int len,
+long double calcChecksum(Real_ptr d, Index_type len,
                          Real_type scale_factor = 1.0);
 ///
-long double calcChecksum(Complex_ptr d, int len,
+long double calcChecksum(Complex_ptr d, Index_type len,
                          Real_type scale_factor = 1.0);
 
 
@@ -9,13 +9,22 @@
 
 #include "Executor.hpp"
 
+#include "common/AffinityUtils.hpp"
+#include "common/CacheUtils.hpp"
+#include "common/CompareUtils.hpp"
 #include "common/KernelBase.hpp"
 #include "common/OutputUtils.hpp"
+#include "common/StatUtils.hpp"
+#include "common/TimerUtils.hpp"
 
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
 #include <mpi.h>
 #endif
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
 // Warmup kernels to run first to help reduce startup overheads in timings
 #include "basic/DAXPY.hpp"
 #include "basic/REDUCE3_INT.hpp"
@@ -24,6 +33,11 @@
 #include "apps/HALOEXCHANGE_FUSED.hpp"
 
 #include <list>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <tuple>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -44,6 +58,62 @@ using namespace std;
 
 namespace {
 
+//
+// Largest problem size at which kernels are set up to estimate their data
+// footprint in a dry run; larger sizes are extrapolated.
+//
+const Index_type footprint_probe_size = 1 << 16;
+
+/*
+ * Barrier for a fixed number of threads; reusable.
+ */
+class ThreadBarrier
+{
+public:
+  explicit ThreadBarrier(size_t count)
+    : num_threads(count), num_waiting(0), generation(0) { }
+
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(barrier_mutex);
+    const size_t wait_generation = generation;
+    if ( ++num_waiting == num_threads ) {
+      num_waiting = 0;
+      ++generation;
+      barrier_cond.notify_all();
+    } else {
+      barrier_cond.wait(lock, [&]() { return wait_generation != generation; });
+    }
+  }
+
+private:
+  std::mutex barrier_mutex;
+  std::condition_variable barrier_cond;
+  size_t num_threads;
+  size_t num_waiting;
+  size_t generation;
+};
+
+/*
+ * Return CPU list as ranges separated by spaces, e.g. "0-3 8".
+ */
+string getCPURangesString(const vector<int>& cpus)
+{
+  ostringstream ranges;
+  for (size_t ic = 0; ic < cpus.size(); ) {
+    size_t jc = ic;
+    while ( jc+1 < cpus.size() && cpus[jc+1] == cpus[jc] + 1 ) {
+      ++jc;
+    }
+    ranges << (ic > 0 ? " " : "") << cpus[ic];
+    if ( jc > ic ) {
+      ranges << "-" << cpus[jc];
+    }
+    ic = jc + 1;
+  }
+  return ranges.str();
+}
+
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
 
 void Allreduce(const Checksum_type* send, Checksum_type* recv, int count,
@@ -98,12 +168,27 @@ void Allreduce(const Checksum_type* send, Checksum_type* recv, int count,
 
 #endif
 
+//
+// Return true if variant runs on host sequentially or with OpenMP threads.
+//
+bool isSeqVariant(VariantID vid)
+{
+  return vid == Base_Seq || vid == Lambda_Seq || vid == RAJA_Seq ||
+         vid == Base_SIMD;
+}
+
+bool isOpenMPVariant(VariantID vid)
+{
+  return vid == Base_OpenMP || vid == Lambda_OpenMP || vid == RAJA_OpenMP;
+}
+
 }
 
 Executor::Executor(int argc, char** argv)
   : run_params(argc, argv),
     reference_vid(NumVariants),
-    reference_tune_idx(KernelBase::getUnknownTuningIdx())
+    reference_tune_idx(KernelBase::getUnknownTuningIdx()),
+    exit_status(0)
 {
 }
 
@@ -113,6 +198,22 @@ Executor::~Executor()
   for (size_t ik = 0; ik < kernels.size(); ++ik) {
     delete kernels[ik];
   }
+  for (vector<KernelBase*>& sweep_kerns : sweep_kernels) {
+    for (KernelBase* kern : sweep_kerns) {
+      delete kern;
+    }
+  }
+  for (vector<KernelBase*>& sweep_kerns : size_sweep_kernels) {
+    for (KernelBase* kern : sweep_kerns) {
+      delete kern;
+    }
+  }
+  for (vector<KernelBase*>& group_kerns : corun_kernels) {
+    for (KernelBase* kern : group_kerns) {
+      delete kern;
+    }
+  }
+  detail::closePerfCounters();
 }
 
 
@@ -125,6 +226,13 @@ void Executor::setupSuite()
 
   getCout() << "\nSetting up suite based on input..." << endl;
 
+  detail::setDataInitMode(run_params.getDataInitMode());
+  detail::setHostMemoryMode(run_params.getHostMemoryMode());
+  detail::setDataCache(run_params.getDataCache());
+  detail::setThreadBinding(run_params.getThreadBinding(),
+                           run_params.getThreadBindCPUs());
+  detail::calibrateTimer(run_params.getTimerBackend());
+
   using Slist = list<string>;
   using Svector = vector<string>;
   using COvector = vector<RunParams::CombinerOpt>;
@@ -159,6 +267,40 @@ void Executor::setupSuite()
 
   }
 
+  //
+  // Determine which hardware counters to collect; all by default when
+  // counters are requested without names.
+  //
+  if ( run_params.getPerfCounters() ) {
+
+    vector<PerfCounterID> pcids;
+    Svector invalid;
+
+    const Svector& perf_counter_input = run_params.getPerfCounterInput();
+    if ( perf_counter_input.empty() ) {
+      for (size_t ipc = 0; ipc < NumPerfCounters; ++ipc) {
+        pcids.emplace_back(static_cast<PerfCounterID>(ipc));
+      }
+    }
+    for (const std::string& counter_name : perf_counter_input) {
+      bool found_it = false;
+      for (size_t ipc = 0; ipc < NumPerfCounters && !found_it; ++ipc) {
+        PerfCounterID pcid = static_cast<PerfCounterID>(ipc);
+        if ( getPerfCounterName(pcid) == counter_name ) {
+          pcids.emplace_back(pcid);
+          found_it = true;
+        }
+      }
+      if ( !found_it ) {
+        invalid.emplace_back(counter_name);
+      }
+    }
+
+    run_params.setPerfCounterIDs(pcids);
+    run_params.setInvalidPerfCounterInput(invalid);
+
+  }
+
   //
   // Determine which kernels to exclude from input.
   // exclude_kern will be non-duplicated ordered set of IDs of kernel to exclude.
@@ -580,6 +722,10 @@ void Executor::setupSuite()
 
     run_params.setInputState(RunParams::BadInput);
 
+  } else if ( !(run_params.getInvalidPerfCounterInput().empty()) ) {
+
+    run_params.setInputState(RunParams::BadInput);
+
   } else if ( !(run_params.getInvalidKernelInput().empty()) ||
               !(run_params.getInvalidExcludeKernelInput().empty()) ) {
 
@@ -650,6 +796,10 @@ void Executor::setupSuite()
         run_params.setInputState(RunParams::PerfRun);
       }
 
+      if ( run_params.getInputState() == RunParams::DryRun ) {
+        estimateDataFootprints();
+      }
+
     } // kernel and variant input both look good
 
   } // if kernel input looks good
@@ -657,6 +807,77 @@ void Executor::setupSuite()
 }
 
 
+/*
+ * Estimate data each kernel allocates, and process peak RSS it would
+ * reach, without allocating data at its problem size. Kernels larger than
+ * the probe size are set up at two smaller sizes and bytes in each data
+ * space are fitted linearly in problem size. Only data allocated in setUp
+ * of the first variant run is counted; device data is usually allocated
+ * when a variant runs, so it is not estimated.
+ */
+void Executor::estimateDataFootprints()
+{
+  const size_t base_rss_bytes = detail::getPeakRSSBytes();
+
+  for (KernelBase* kernel : kernels) {
+
+    VariantID probe_vid = NumVariants;
+    for (VariantID vid : variant_ids) {
+      if ( kernel->hasVariantDefined(vid) ) {
+        probe_vid = vid;
+        break;
+      }
+    }
+    if ( probe_vid == NumVariants ) {
+      continue;
+    }
+
+    detail::DataFootprint estimate;
+    const Index_type psize = kernel->getActualProblemSize();
+
+    if ( psize <= footprint_probe_size ) {
+
+      kernel->measureDataFootprint(probe_vid, 0);
+      estimate = kernel->getDataFootprint();
+
+    } else {
+
+      Index_type probe_psize[2];
+      detail::DataFootprint probe_footprint[2];
+      for (int ip = 0; ip < 2; ++ip) {
+        // kernels hold a reference to their run params
+        RunParams probe_params(run_params);
+        probe_params.setSize(footprint_probe_size / (2 - ip));
+        KernelBase* probe = getKernelObject(kernel->getKernelID(), probe_params);
+        probe->measureDataFootprint(probe_vid, 0);
+        probe_psize[ip] = probe->getActualProblemSize();
+        probe_footprint[ip] = probe->getDataFootprint();
+        delete probe;
+      }
+
+      for (size_t ids = 0;
+           ids < static_cast<size_t>(detail::DataSpace::NumSpaces); ++ids) {
+        const double bytes0 =
+          static_cast<double>(probe_footprint[0].high_water_bytes[ids]);
+        const double bytes1 =
+          static_cast<double>(probe_footprint[1].high_water_bytes[ids]);
+        const double slope = ( probe_psize[1] > probe_psize[0] ) ?
+          (bytes1 - bytes0) / (probe_psize[1] - probe_psize[0]) : 0.0;
+        const double bytes = bytes1 + slope * (psize - probe_psize[1]);
+        estimate.high_water_bytes[ids] =
+          ( bytes > 0.0 ) ? static_cast<size_t>(bytes) : 0;
+      }
+
+    }
+
+    detail::releaseDataCache();
+
+    kernel->setDataFootprintEstimate(estimate, base_rss_bytes +
+        estimate.getHighWaterBytes(detail::DataSpace::Host));
+  }
+}
+
+
 void Executor::reportRunSummary(ostream& str) const
 {
   RunParams::InputOpt in_state = run_params.getInputState();
@@ -711,6 +932,58 @@ void Executor::reportRunSummary(ostream& str) const
       str << "\t Kernel size = " << run_params.getSize() << endl;
     }
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+    str << "\t Data init mode = "
+        << RunParams::DataInitModeToStr(run_params.getDataInitMode()) << endl;
+    str << "\t Host memory mode = "
+        << RunParams::HostMemoryModeToStr(run_params.getHostMemoryMode()) << endl;
+    str << "\t Timer = "
+        << RunParams::TimerBackendToStr(detail::getTimerBackend())
+        << " (resolution = " << detail::getTimerResolution() * 1.0e9
+        << " ns, overhead = " << detail::getTimerOverhead() * 1.0e9
+        << " ns subtracted from each timed sample)" << endl;
+    if (run_params.getCacheMode() == RunParams::CacheMode::ColdCache) {
+      str << "\t Cache mode = cold (each rep timed after reading "
+          << detail::getCacheScrubBytes() / (1024*1024)
+          << " MiB to evict host caches)" << endl;
+    }
+    if (run_params.getSizeSweep().size() > 1) {
+      str << "\t Size sweep = " << run_params.getSizeSweep().size()
+          << " sizes from " << run_params.getSizeSweep().front()
+          << " to " << run_params.getSizeSweep().back() << endl;
+    }
+    if (!run_params.getThreadSweep().empty()) {
+      str << "\t OpenMP thread sweep = ";
+      for (size_t it = 0; it < run_params.getThreadSweep().size(); ++it) {
+        str << (it > 0 ? ", " : "") << run_params.getThreadSweep()[it];
+      }
+      str << (run_params.getWeakScaling() ? " (weak scaling)" : " (strong scaling)")
+          << endl;
+    }
+    if (run_params.getCorunInstances() > 0) {
+      str << "\t Co-run instances of each kernel = "
+          << run_params.getCorunInstances() << endl;
+    }
+    if (!run_params.getCorunKernelInput().empty()) {
+      str << "\t Co-run kernel mix =";
+      for (const string& kname : run_params.getCorunKernelInput()) {
+        str << " " << kname;
+      }
+      str << endl;
+    }
+    if (run_params.getThreadBinding() != RunParams::ThreadBinding::NoBinding) {
+      str << "\t OpenMP thread binding = "
+          << RunParams::ThreadBindingToStr(run_params.getThreadBinding()) << endl;
+    }
+    if (run_params.getDataCache()) {
+      str << "\t Kernel host data is cached between runs" << endl;
+    }
+    if (run_params.getAdaptiveReps()) {
+      str << "\t Kernel reps are adaptive (CI target = " << run_params.getCITarget()
+          << "%, max time = " << run_params.getCIMaxTime() << " sec.)" << endl;
+    }
+    if (run_params.getSampleReps() > 0) {
+      str << "\t Kernel reps per timing sample = " << run_params.getSampleReps() << endl;
+    }
     str << "\t Output files will be named " << ofiles << endl;
 
     str << "\nThe following kernels and variants (when available for a kernel) will be run:" << endl;
@@ -725,8 +998,10 @@ void Executor::reportRunSummary(ostream& str) const
 
     str << endl;
 
+    // data footprints are only known before the run when estimated
     bool to_file = false;
-    writeKernelInfoSummary(str, to_file);
+    bool show_footprint = ( in_state == RunParams::DryRun );
+    writeKernelInfoSummary(str, to_file, show_footprint);
 
   }
 
@@ -734,7 +1009,8 @@ void Executor::reportRunSummary(ostream& str) const
 }
 
 
-void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
+void Executor::writeKernelInfoSummary(ostream& str, bool to_file,
+                                      bool show_footprint) const
 {
   if ( to_file ) {
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
@@ -759,6 +1035,12 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
   Index_type flopsrep_width = 0;
   Index_type dash_width = 0;
 
+  const vector<detail::DataSpace> data_spaces{detail::DataSpace::Host,
+                                              detail::DataSpace::Pinned,
+                                              detail::DataSpace::Device};
+  vector<size_t> databytes_width(data_spaces.size(), 0);
+  size_t rss_width = 0;
+
   for (size_t ik = 0; ik < kernels.size(); ++ik) {
     kercol_width = max(kercol_width, kernels[ik]->getName().size());
     psize_width = max(psize_width, kernels[ik]->getActualProblemSize());
@@ -766,6 +1048,11 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
     itsrep_width = max(reps_width, kernels[ik]->getItsPerRep());
     bytesrep_width = max(bytesrep_width, kernels[ik]->getBytesPerRep());
     flopsrep_width = max(bytesrep_width, kernels[ik]->getFLOPsPerRep());
+    for (size_t ids = 0; ids < data_spaces.size(); ++ids) {
+      databytes_width[ids] = max(databytes_width[ids],
+          kernels[ik]->getDataFootprint().getHighWaterBytes(data_spaces[ids]));
+    }
+    rss_width = max(rss_width, kernels[ik]->getPeakRSSBytes());
   }
 
   const string sepchr(" , ");
@@ -809,14 +1096,44 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
                          static_cast<Index_type>(frsize) ) + 3;
   dash_width += flopsrep_width + static_cast<Index_type>(sepchr.size());
 
+  //
+  // Data bytes are the most a kernel held at once in each space.
+  //
+  vector<string> databytes_head;
+  for (size_t ids = 0; ids < data_spaces.size(); ++ids) {
+    double dbsize = log10( static_cast<double>(max(databytes_width[ids],
+                                                   static_cast<size_t>(1))) );
+    databytes_head.push_back(detail::getDataSpaceName(data_spaces[ids]) +
+                             " data bytes");
+    databytes_width[ids] = max( databytes_head[ids].size(),
+                                static_cast<size_t>(dbsize) ) + 3;
+    if ( show_footprint ) {
+      dash_width += databytes_width[ids] + sepchr.size();
+    }
+  }
+
+  double rsize_bytes = log10( static_cast<double>(max(rss_width,
+                                                      static_cast<size_t>(1))) );
+  string rss_head("Peak RSS bytes");
+  rss_width = max( rss_head.size(), static_cast<size_t>(rsize_bytes) ) + 3;
+  if ( show_footprint ) {
+    dash_width += rss_width + sepchr.size();
+  }
+
   str <<left<< setw(kercol_width) << kern_head
       << sepchr <<right<< setw(psize_width) << psize_head
       << sepchr <<right<< setw(reps_width) << rsize_head
       << sepchr <<right<< setw(itsrep_width) << itsrep_head
       << sepchr <<right<< setw(kernsrep_width) << kernsrep_head
       << sepchr <<right<< setw(bytesrep_width) << bytesrep_head
-      << sepchr <<right<< setw(flopsrep_width) << flopsrep_head
-      << endl;
+      << sepchr <<right<< setw(flopsrep_width) << flopsrep_head;
+  if ( show_footprint ) {
+    for (size_t ids = 0; ids < data_spaces.size(); ++ids) {
+      str << sepchr <<right<< setw(databytes_width[ids]) << databytes_head[ids];
+    }
+    str << sepchr <<right<< setw(rss_width) << rss_head;
+  }
+  str << endl;
 
   if ( !to_file ) {
     for (Index_type i = 0; i < dash_width; ++i) {
@@ -833,8 +1150,15 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
         << sepchr <<right<< setw(itsrep_width) << kern->getItsPerRep()
         << sepchr <<right<< setw(kernsrep_width) << kern->getKernelsPerRep()
         << sepchr <<right<< setw(bytesrep_width) << kern->getBytesPerRep()
-        << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep()
-        << endl;
+        << sepchr <<right<< setw(flopsrep_width) << kern->getFLOPsPerRep();
+    if ( show_footprint ) {
+      for (size_t ids = 0; ids < data_spaces.size(); ++ids) {
+        str << sepchr <<right<< setw(databytes_width[ids])
+            << kern->getDataFootprint().getHighWaterBytes(data_spaces[ids]);
+      }
+      str << sepchr <<right<< setw(rss_width) << kern->getPeakRSSBytes();
+    }
+    str << endl;
   }
 
   str.flush();
@@ -849,6 +1173,19 @@ void Executor::runSuite()
     return;
   }
 
+  //
+  // Open hardware counters before any kernel runs so they also count
+  // events in OpenMP threads.
+  //
+  if ( !run_params.getPerfCounterIDs().empty() ) {
+    if ( !detail::openPerfCounters(run_params.getPerfCounterIDs()) ) {
+      getCout() << "\n No perf counters could be opened;"
+                << " counters will not be reported" << endl;
+    }
+  }
+
+  detail::bindOpenMPThreads();
+
   getCout() << "\n\nRun warmup kernels...\n";
 
   vector<KernelBase*> warmup_kernels;
@@ -861,12 +1198,16 @@ void Executor::runSuite()
 
   for (size_t ik = 0; ik < warmup_kernels.size(); ++ik) {
     KernelBase* warmup_kernel = warmup_kernels[ik];
-    runKernel(warmup_kernel, true);
+    runKernel(warmup_kernel, true, variant_ids);
     delete warmup_kernel;
     warmup_kernels[ik] = nullptr;
   }
 
 
+  if ( run_params.getRoofline() ) {
+    calibrateRoofline();
+  }
+
   getCout() << "\n\nRunning specified kernels and variants...\n";
 
   const int npasses = run_params.getNumPasses();
@@ -877,11 +1218,315 @@ void Executor::runSuite()
 
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       KernelBase* kernel = kernels[ik];
-      runKernel(kernel, false);
+      runKernel(kernel, false, variant_ids);
     } // loop over kernels
 
   } // loop over passes through suite
 
+  detail::releaseDataCache();
+
+  if ( run_params.getSizeSweep().size() > 1 ) {
+    runSizeSweep();
+  }
+
+  if ( !run_params.getThreadSweep().empty() ) {
+    runThreadSweep();
+  }
+
+  if ( run_params.getCorunInstances() > 0 ||
+       !run_params.getCorunKernelInput().empty() ) {
+    runCorun();
+  }
+}
+
+void Executor::runCorun()
+{
+  getCout() << "\n\nRunning co-run kernels...\n";
+
+  //
+  // Each group is a set of kernels run at the same time: copies of each
+  // kernel, and the given mix of kernels.
+  //
+  vector<vector<KernelID>> groups;
+  if ( run_params.getCorunInstances() > 0 ) {
+    for (KernelBase* kernel : kernels) {
+      groups.emplace_back(run_params.getCorunInstances(),
+                          kernel->getKernelID());
+    }
+  }
+  if ( !run_params.getCorunKernelInput().empty() ) {
+    vector<KernelID> mix;
+    for (const string& kname : run_params.getCorunKernelInput()) {
+      size_t kid = 0;
+      while ( kid < NumKernels &&
+              kname != getFullKernelName(static_cast<KernelID>(kid)) &&
+              kname != getKernelName(static_cast<KernelID>(kid)) ) {
+        ++kid;
+      }
+      if ( kid < NumKernels ) {
+        mix.push_back(static_cast<KernelID>(kid));
+      } else {
+        getCout() << "\n Unknown co-run kernel " << kname
+                  << "; co-run kernel mix will not be run" << endl;
+        mix.clear();
+        break;
+      }
+    }
+    if ( !mix.empty() ) {
+      groups.push_back(mix);
+    }
+  }
+
+  vector<int> cpus;
+  detail::getAvailableCPUs(cpus);
+
+  // cached data may not be shared by concurrently running kernels
+  detail::setDataCache(false);
+  // counters are one group for the process, so instances would count
+  // events of each other
+  detail::setPerfCounting(false);
+
+  for (const vector<KernelID>& group : groups) {
+
+    const size_t ninst = group.size();
+    if ( cpus.size() < ninst ) {
+      getCout() << "\n Can't co-run " << ninst << " kernel instances on "
+                << cpus.size() << " available CPUs" << endl;
+      break;
+    }
+
+    const size_t igroup = corun_kernels.size();
+    corun_kernels.emplace_back();
+    corun_cpus.emplace_back();
+    corun_params.emplace_back();
+
+    //
+    // Instance i runs on ith of ninst equal parts of the available CPUs.
+    //
+    for (size_t inst = 0; inst < ninst; ++inst) {
+      corun_cpus[igroup].emplace_back(cpus.begin() + inst * cpus.size() / ninst,
+                                      cpus.begin() + (inst+1) * cpus.size() / ninst);
+      corun_params[igroup].emplace_back(new RunParams(run_params));
+      corun_kernels[igroup].push_back(
+        getKernelObject(group[inst], *corun_params[igroup].back()) );
+    }
+
+    for (VariantID vid : variant_ids) {
+      if ( !isSeqVariant(vid) && !isOpenMPVariant(vid) ) {
+        continue;
+      }
+      bool all_defined = true;
+      for (KernelBase* kern : corun_kernels[igroup]) {
+        all_defined = all_defined && kern->hasVariantDefined(vid);
+      }
+      if ( all_defined ) {
+        if ( run_params.showProgress() ) {
+          getCout() << "\nCo-run of";
+          for (KernelBase* kern : corun_kernels[igroup]) {
+            getCout() << " " << kern->getName();
+          }
+          getCout() << " " << getVariantName(vid) << endl;
+        }
+        runCorunVariant(igroup, vid);
+      }
+    }
+  }
+
+  detail::setDataCache(run_params.getDataCache());
+  detail::setPerfCounting(true);
+}
+
+void Executor::runCorunVariant(size_t igroup, VariantID vid)
+{
+  vector<KernelBase*>& kerns = corun_kernels[igroup];
+  const size_t ninst = kerns.size();
+  const int npasses = run_params.getNumPasses();
+  const size_t tune_idx = 0;
+
+  CorunResult result;
+  result.igroup = igroup;
+  result.vid = vid;
+  result.tune_idx = tune_idx;
+  result.solo_time.resize(ninst, 0.0);
+  result.corun_time.resize(ninst, 0.0);
+  result.corun_reps.resize(ninst, 0.0);
+
+  //
+  // Each instance runs in its own thread bound to its CPUs; OpenMP variants
+  // run with one OpenMP thread for each CPU.
+  //
+  auto run_instance = [&](size_t inst) {
+    const vector<int>& inst_cpus = corun_cpus[igroup][inst];
+    if ( isOpenMPVariant(vid) ) {
+      detail::setThreadBinding(RunParams::ThreadBinding::ListBinding, inst_cpus);
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+      omp_set_num_threads(static_cast<int>(inst_cpus.size()));
+#endif
+    } else {
+      detail::bindThreadToCPUs(vector<int>(1, inst_cpus.front()));
+    }
+    for (int ip = 0; ip < npasses; ++ip) {
+      kerns[inst]->execute(vid, tune_idx);
+    }
+  };
+
+  //
+  // Run each instance alone on its CPUs.
+  //
+  vector<double> solo_pass_time(ninst, 0.0);
+  for (size_t inst = 0; inst < ninst; ++inst) {
+    corun_params[igroup][inst]->setRepFactor(run_params.getRepFactor());
+    std::thread solo_thread(run_instance, inst);
+    solo_thread.join();
+    solo_pass_time[inst] = kerns[inst]->getTotTime(vid, tune_idx) / npasses;
+    // times are reported for the nominal reps of each pass
+    if ( kerns[inst]->getRunReps() > 0 ) {
+      result.solo_time[inst] = solo_pass_time[inst] /
+                               kerns[inst]->getRunReps();
+    }
+  }
+
+  //
+  // Scale reps so each instance runs about as long as the longest one,
+  // so instances overlap for the whole time they are timed.
+  //
+  const double max_pass_time = *max_element(solo_pass_time.begin(),
+                                            solo_pass_time.end());
+  for (size_t inst = 0; inst < ninst; ++inst) {
+    if ( solo_pass_time[inst] > 0.0 ) {
+      corun_params[igroup][inst]->setRepFactor(
+          run_params.getRepFactor() * max_pass_time / solo_pass_time[inst]);
+    }
+  }
+
+  //
+  // Run all instances at the same time; instances wait for each other
+  // after set up so timed reps start together.
+  //
+  vector<double> tot_time(ninst);
+  for (size_t inst = 0; inst < ninst; ++inst) {
+    tot_time[inst] = kerns[inst]->getTotTime(vid, tune_idx);
+  }
+
+  ThreadBarrier barrier(ninst);
+  for (KernelBase* kern : kerns) {
+    kern->setStartHook([&barrier]() { barrier.wait(); });
+  }
+
+  vector<std::thread> corun_threads;
+  for (size_t inst = 0; inst < ninst; ++inst) {
+    corun_threads.emplace_back(run_instance, inst);
+  }
+  for (std::thread& corun_thread : corun_threads) {
+    corun_thread.join();
+  }
+
+  for (size_t inst = 0; inst < ninst; ++inst) {
+    kerns[inst]->setStartHook(nullptr);
+    double time = kerns[inst]->getTotTime(vid, tune_idx) - tot_time[inst];
+    double reps = static_cast<double>(kerns[inst]->getRunReps()) * npasses;
+    if ( reps > 0.0 ) {
+      result.corun_time[inst] = time / reps;
+    }
+    result.corun_reps[inst] = reps / npasses;
+  }
+
+  corun_results.push_back(result);
+}
+
+void Executor::runSizeSweep()
+{
+  getCout() << "\n\nRunning size sweep...\n";
+
+  const vector<double>& sizes = run_params.getSizeSweep();
+
+  //
+  // Main run used the first size; kernels hold a reference to their run
+  // params, so each other size gets its own copy.
+  //
+  for (size_t isz = 1; isz < sizes.size(); ++isz) {
+
+    getCout() << "\nSize sweep with size " << sizes[isz] << "\n";
+
+    size_sweep_params.emplace_back(new RunParams(run_params));
+    size_sweep_params.back()->setSize(sizes[isz]);
+
+    size_sweep_kernels.emplace_back();
+    for (KernelBase* kernel : kernels) {
+      size_sweep_kernels.back().push_back(
+        getKernelObject(kernel->getKernelID(), *size_sweep_params.back()) );
+    }
+
+    const int npasses = run_params.getNumPasses();
+    for (int ip = 0; ip < npasses; ++ip) {
+      for (KernelBase* kernel : size_sweep_kernels.back()) {
+        runKernel(kernel, false, variant_ids);
+      }
+    }
+
+    detail::releaseDataCache();
+  }
+}
+
+void Executor::runThreadSweep()
+{
+  vector<VariantID> omp_variant_ids;
+  for (VariantID vid : variant_ids) {
+    if ( isOpenMPVariant(vid) ) {
+      omp_variant_ids.push_back(vid);
+    }
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( omp_variant_ids.empty() ) {
+    getCout() << "\n\nNo OpenMP variants to run in thread sweep\n";
+    return;
+  }
+
+  getCout() << "\n\nRunning OpenMP variants in thread sweep...\n";
+
+  const int default_num_threads = omp_get_max_threads();
+
+  for (int num_threads : run_params.getThreadSweep()) {
+
+    getCout() << "\nThread sweep with " << num_threads << " threads\n";
+
+    omp_set_num_threads(num_threads);
+    detail::bindOpenMPThreads();
+
+    // cached data was first touched by a different number of threads
+    detail::releaseDataCache();
+
+    //
+    // Kernels hold a reference to their run params, so each thread count
+    // gets its own copy, with problem sizes scaled for weak scaling.
+    //
+    sweep_params.emplace_back(new RunParams(run_params));
+    if ( run_params.getWeakScaling() ) {
+      sweep_params.back()->scaleProblemSize(num_threads);
+    }
+
+    sweep_kernels.emplace_back();
+    for (KernelBase* kernel : kernels) {
+      sweep_kernels.back().push_back(
+        getKernelObject(kernel->getKernelID(), *sweep_params.back()) );
+    }
+
+    const int npasses = run_params.getNumPasses();
+    for (int ip = 0; ip < npasses; ++ip) {
+      for (KernelBase* kernel : sweep_kernels.back()) {
+        runKernel(kernel, false, omp_variant_ids);
+      }
+    }
+
+    detail::releaseDataCache();
+  }
+
+  omp_set_num_threads(default_num_threads);
+  detail::bindOpenMPThreads();
+#else
+  getCout() << "\n\nThread sweep requires OpenMP; it will not be run\n";
+#endif
 }
 
 template < typename Kernel >
@@ -891,13 +1536,15 @@ KernelBase* Executor::makeKernel()
   return kernel;
 }
 
-void Executor::runKernel(KernelBase* kernel, bool print_kernel_name)
+void Executor::runKernel(KernelBase* kernel, bool print_kernel_name,
+                         const vector<VariantID>& vids)
 {
   if ( run_params.showProgress() || print_kernel_name) {
     getCout()  << endl << "Run kernel -- " << kernel->getName() << endl;
   }
-  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-    VariantID vid = variant_ids[iv];
+  detail::setDataCacheKernel(kernel->getKernelID());
+  for (size_t iv = 0; iv < vids.size(); ++iv) {
+    VariantID vid = vids[iv];
 
     if ( run_params.showProgress() ) {
       if ( kernel->hasVariantDefined(vid) ) {
@@ -930,6 +1577,11 @@ void Executor::outputRunData()
     return;
   }
 
+  // compare files are named relative to directory where suite is run
+  if ( !run_params.getCompareFiles().empty() ) {
+    compareBaselines();
+  }
+
   getCout() << "\n\nGenerate run report files...\n";
 
   //
@@ -955,28 +1607,218 @@ void Executor::outputRunData()
     }
   }
 
-  file = openOutputFile(out_fprefix + "-checksum.txt");
-  writeChecksumReport(*file);
+  if ( !run_params.getPerfCounterIDs().empty() ) {
+    file = openOutputFile(out_fprefix + "-counters.csv");
+    writePerfCountersReport(*file);
+  }
 
-  {
-    vector<FOMGroup> fom_groups;
-    getFOMGroups(fom_groups);
-    if (!fom_groups.empty() ) {
-      file = openOutputFile(out_fprefix + "-fom.csv");
-      writeFOMReport(*file, fom_groups);
-    }
+  if ( seq_roofline.calibrated || omp_roofline.calibrated ) {
+    file = openOutputFile(out_fprefix + "-roofline.csv");
+    writeRooflineReport(*file);
   }
 
-  file = openOutputFile(out_fprefix + "-kernels.csv");
-  if ( *file ) {
-    bool to_file = true;
-    writeKernelInfoSummary(*file, to_file);
+  if ( run_params.getAdaptiveReps() ) {
+    file = openOutputFile(out_fprefix + "-reps.csv");
+    writeCSVReport(*file, CSVRepMode::Reps, RunParams::CombinerOpt::Average, 1 /* prec */);
   }
-}
 
-unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
-{
-  int rank = 0;
+  bool have_placement = false;
+  for (KernelBase* kern : kernels) {
+    have_placement = have_placement || !kern->getOpenMPThreadCPUs().empty();
+  }
+  if ( have_placement ) {
+    file = openOutputFile(out_fprefix + "-affinity.csv");
+    writeAffinityReport(*file);
+  }
+
+  if ( !size_sweep_kernels.empty() ) {
+    file = openOutputFile(out_fprefix + "-size-sweep.csv");
+    writeSizeSweepReport(*file);
+  }
+
+  if ( !sweep_kernels.empty() ) {
+    file = openOutputFile(out_fprefix + "-thread-sweep.csv");
+    writeThreadSweepReport(*file);
+  }
+
+  if ( !corun_results.empty() ) {
+    file = openOutputFile(out_fprefix + "-corun.csv");
+    writeCorunReport(*file);
+  }
+
+  if ( !run_params.getCompareFiles().empty() ) {
+    file = openOutputFile(out_fprefix + "-compare.csv");
+    writeCompareReport(*file);
+  }
+
+  file = openOutputFile(out_fprefix + "-pagefaults.csv");
+  writeCSVReport(*file, CSVRepMode::MinorPageFaults, RunParams::CombinerOpt::Average, 1 /* prec */);
+  if ( *file ) {
+    *file << endl;
+  }
+  writeCSVReport(*file, CSVRepMode::MajorPageFaults, RunParams::CombinerOpt::Average, 1 /* prec */);
+
+  file = openOutputFile(out_fprefix + "-checksum.txt");
+  writeChecksumReport(*file);
+
+  {
+    vector<FOMGroup> fom_groups;
+    getFOMGroups(fom_groups);
+    if (!fom_groups.empty() ) {
+      file = openOutputFile(out_fprefix + "-fom.csv");
+      writeFOMReport(*file, fom_groups);
+    }
+  }
+
+  if ( run_params.getSampleReps() > 0 ) {
+    file = openOutputFile(out_fprefix + "-samples.csv");
+    writeSamplesReport(*file);
+
+    file = openOutputFile(out_fprefix + "-histogram.csv");
+    writeHistogramReport(*file);
+  }
+
+  file = openOutputFile(out_fprefix + "-kernels.csv");
+  if ( *file ) {
+    bool to_file = true;
+    bool show_footprint = true;
+    writeKernelInfoSummary(*file, to_file, show_footprint);
+  }
+
+  file = openOutputFile(out_fprefix + "-data.jsonl");
+  writeJSONReport(*file);
+}
+
+void Executor::compareBaselines()
+{
+  getCout() << "\n\nCompare with previous runs...\n";
+
+  const vector<string>& compare_files = run_params.getCompareFiles();
+  const double threshold = 1.0 + run_params.getCompareThreshold() / 100.0;
+  const int npasses = run_params.getNumPasses();
+
+  size_t num_regressions = 0;
+
+  for (size_t ibase = 0; ibase < compare_files.size(); ++ibase) {
+
+    vector<BaselineResult> results;
+    if ( !readBaselineResults(compare_files[ibase], results) ) {
+      getCout() << "\n Unable to read results from compare file "
+                << compare_files[ibase] << endl;
+      exit_status = 1;
+    }
+    num_baseline_results.push_back(results.size());
+
+    map<tuple<string, string, string>, size_t> result_index;
+    for (size_t ir = 0; ir < results.size(); ++ir) {
+      result_index[make_tuple(results[ir].kernel, results[ir].variant,
+                              results[ir].tuning)] = ir;
+    }
+
+    for (KernelBase* kern : kernels) {
+      for (VariantID vid : variant_ids) {
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid);
+             ++tune_idx) {
+
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          auto found = result_index.find(
+              make_tuple(kern->getName(), getVariantName(vid),
+                         kern->getVariantTuningName(vid, tune_idx)) );
+          if ( found == result_index.end() ) {
+            continue;
+          }
+          const BaselineResult& base = results[found->second];
+
+          //
+          // Compare times per rep if reps of previous run are known, so
+          // runs with different reps (e.g. adaptive reps) can be compared.
+          //
+          double base_avg = base.avg_time;
+          double base_min = base.min_time;
+          double base_max = base.max_time;
+          double avg = kern->getTotTime(vid, tune_idx) / npasses;
+          double min_time = kern->getMinTime(vid, tune_idx);
+          double max_time = kern->getMaxTime(vid, tune_idx);
+
+          // times are reported for the nominal reps, even when adaptive
+          // reps ran a different number
+          double reps = static_cast<double>(kern->getRunReps());
+          bool per_rep = ( base.reps > 0.0 && reps > 0.0 );
+          if ( per_rep ) {
+            base_avg /= base.reps;
+            base_min /= base.reps;
+            base_max /= base.reps;
+            avg /= reps;
+            min_time /= reps;
+            max_time /= reps;
+          }
+
+          BaselineComparison comp;
+          comp.ibase = ibase;
+          comp.kern = kern;
+          comp.vid = vid;
+          comp.tune_idx = tune_idx;
+          comp.per_rep = per_rep;
+          comp.base_time = base_avg;
+          comp.time = avg;
+          comp.ratio = ( base_avg > 0.0 ) ? avg / base_avg : 0.0;
+
+          //
+          // Test significance with timing samples if both runs have them,
+          // else with spread of times over passes. With one pass in each
+          // run there is no spread, and the threshold alone decides.
+          //
+          vector<double> samples(kern->getSampleTimes(vid, tune_idx));
+          bool significant = true;
+          if ( samples.size() > 1 && base.sample_count > 1 ) {
+            comp.test = "samples";
+            significant = isSignificantDifference(
+                calcMean(samples), calcStdDev(samples), samples.size(),
+                base.sample_mean, base.sample_stddev, base.sample_count);
+          } else if ( min_time < max_time || base_min < base_max ) {
+            comp.test = "passes";
+            significant = ( min_time > base_max || max_time < base_min );
+          } else {
+            comp.test = "none";
+          }
+
+          if ( !significant || comp.ratio == 1.0 ) {
+            comp.result = "same";
+          } else if ( comp.ratio > threshold ) {
+            comp.result = "REGRESSION";
+            num_regressions++;
+            getCout() << "\n Regression: " << kern->getName() << " "
+                      << getVariantName(vid) << " "
+                      << kern->getVariantTuningName(vid, tune_idx)
+                      << " is " << comp.ratio << "x time of "
+                      << compare_files[ibase] << endl;
+          } else if ( comp.ratio > 1.0 ) {
+            comp.result = "slower";
+          } else {
+            comp.result = "faster";
+          }
+
+          baseline_comparisons.push_back(comp);
+        }
+      }
+    }
+  }
+
+  getCout() << "\n Compared " << baseline_comparisons.size()
+            << " results with " << compare_files.size()
+            << " previous runs; " << num_regressions << " regressions" << endl;
+
+  if ( num_regressions > 0 ) {
+    exit_status = 1;
+  }
+}
+
+unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
+{
+  int rank = 0;
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
@@ -985,13 +1827,852 @@ unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
     if ( !*file ) {
       getCout() << " ERROR: Can't open output file " << filename << endl;
     }
-    return file;
-  }
-  return unique_ptr<ostream>(makeNullStream());
+    return file;
+  }
+  return unique_ptr<ostream>(makeNullStream());
+}
+
+void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
+                              RunParams::CombinerOpt combiner, size_t prec)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    vector<std::vector<size_t>> vartuncol_width(variant_ids.size());
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      size_t var_width = max(prec+2, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        vartuncol_width[iv].emplace_back(max(var_width, tuning_name.size()));
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << getReportTitle(mode, combiner);
+
+    //
+    // Wrtie CSV file contents for report.
+    //
+
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+        file << sepchr;
+      }
+    }
+    file << endl;
+
+    //
+    // Print column variant name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+        file << sepchr <<left<< setw(vartuncol_width[iv][it])
+             << getVariantName(variant_ids[iv]);
+      }
+    }
+    file << endl;
+
+    //
+    // Print column tuning name line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+        file << sepchr <<left<< setw(vartuncol_width[iv][it])
+             << tuning_names[variant_ids[iv]][it];
+      }
+    }
+    file << endl;
+
+    //
+    // Print row of data for variants of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      file <<left<< setw(kercol_width) << kern->getName();
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
+          std::string const& tuning_name = tuning_names[variant_ids[iv]][it];
+          file << sepchr <<right<< setw(vartuncol_width[iv][it]);
+          if ( (mode == CSVRepMode::Speedup) &&
+               (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
+                !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
+            file << "Not run";
+          } else if ( (mode == CSVRepMode::Timing ||
+                       mode == CSVRepMode::Reps ||
+                       mode == CSVRepMode::MinorPageFaults ||
+                       mode == CSVRepMode::MajorPageFaults) &&
+                      !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            file << "Not run";
+          } else {
+            file << setprecision(prec) << std::fixed
+                 << getReportDataEntry(mode, combiner, kern, vid,
+                        kern->getVariantTuningIndex(vid, tuning_name));
+          }
+        }
+      }
+      file << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeSamplesReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+    const size_t prec = 9;
+    const size_t datacol_width = prec + 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+
+    const vector<string> stat_col_names{ "Samples", "Min", "P5", "Median",
+                                         "P95", "P99", "Max", "Mean",
+                                         "StdDev" };
+
+    //
+    // Print title line.
+    //
+    file << "Per-rep time distribution over timing samples (sec.)"
+         << " (sample reps = " << run_params.getSampleReps() << ")" << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& stat_col_name : stat_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << stat_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of statistics for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+
+          vector<double> vals(kern->getSampleTimes(vid,
+                                kern->getVariantTuningIndex(vid, tuning_name)));
+          if ( vals.empty() ) {
+            continue;
+          }
+          sort(vals.begin(), vals.end());
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << sepchr <<right<< setw(datacol_width) << vals.size()
+               << setprecision(prec) << std::scientific;
+          for (double val : { vals.front(),
+                              calcPercentile(vals, 5.0),
+                              calcPercentile(vals, 50.0),
+                              calcPercentile(vals, 95.0),
+                              calcPercentile(vals, 99.0),
+                              vals.back(),
+                              calcMean(vals),
+                              calcStdDev(vals) }) {
+            file << sepchr <<right<< setw(datacol_width) << val;
+          }
+          file << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeHistogramReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+    const size_t prec = 9;
+    const size_t datacol_width = prec + 6;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Histogram of per-rep times over timing samples (sec.)"
+         << " (bins = " << run_params.getHistogramBins() << ")" << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name
+         << sepchr <<left<< setw(datacol_width) << "Bin lower"
+         << sepchr <<left<< setw(datacol_width) << "Bin upper"
+         << sepchr <<left<< setw(datacol_width) << "Count" << endl;
+
+    //
+    // Print one row per histogram bin for each kernel variant tuning run.
+    //
+    vector<double> bin_lo;
+    vector<double> bin_hi;
+    vector<size_t> counts;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+
+          calcHistogram(kern->getSampleTimes(vid,
+                          kern->getVariantTuningIndex(vid, tuning_name)),
+                        run_params.getHistogramBins(), bin_lo, bin_hi, counts);
+
+          for (size_t ib = 0; ib < counts.size(); ++ib) {
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name
+                 << setprecision(prec) << std::scientific
+                 << sepchr <<right<< setw(datacol_width) << bin_lo[ib]
+                 << sepchr <<right<< setw(datacol_width) << bin_hi[ib]
+                 << sepchr <<right<< setw(datacol_width) << counts[ib] << endl;
+          }
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writePerfCountersReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+
+    //
+    // Counts per rep for each counter collected, followed by derived
+    // instructions per cycle and misses per loop iteration.
+    //
+    vector<PerfCounterID> count_ids;
+    vector<PerfCounterID> miss_ids;
+    for (size_t ipc = 0; ipc < NumPerfCounters; ++ipc) {
+      PerfCounterID pcid = static_cast<PerfCounterID>(ipc);
+      if ( detail::perfCounterOpen(pcid) ) {
+        count_ids.emplace_back(pcid);
+        if ( pcid == LLC_Misses || pcid == DTLB_Misses ||
+             pcid == Branch_Misses ) {
+          miss_ids.emplace_back(pcid);
+        }
+      }
+    }
+    const bool have_ipc = detail::perfCounterOpen(Cycles) &&
+                          detail::perfCounterOpen(Instructions);
+
+    vector<string> data_col_names;
+    for (PerfCounterID pcid : count_ids) {
+      data_col_names.emplace_back(getPerfCounterName(pcid) + "/rep");
+    }
+    if ( have_ipc ) {
+      data_col_names.emplace_back("IPC");
+    }
+    for (PerfCounterID pcid : miss_ids) {
+      data_col_names.emplace_back(getPerfCounterName(pcid) + "/iter");
+    }
+
+    size_t datacol_width = prec + 10;
+    for (string const& data_col_name : data_col_names) {
+      datacol_width = max(datacol_width, data_col_name.size());
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Hardware Counter Report (counts while kernel timed)" << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& data_col_name : data_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_name;
+    }
+    file << endl;
+
+    //
+    // Print row of counter data for each kernel variant tuning that was run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(prec) << std::scientific;
+
+          long double reps = kern->getTotReps(vid, tune_idx);
+          long double iters = reps * kern->getItsPerRep();
+
+          // counts are incomplete if counter group was not scheduled
+          // each time kernel was timed
+          if ( !kern->getPerfCountsScheduled(vid, tune_idx) ) {
+            for (size_t ic = 0; ic < data_col_names.size(); ++ic) {
+              file << sepchr <<right<< setw(datacol_width) << "-";
+            }
+            file << endl;
+            continue;
+          }
+
+          for (PerfCounterID pcid : count_ids) {
+            long double count = kern->getTotPerfCount(vid, tune_idx, pcid);
+            file << sepchr <<right<< setw(datacol_width)
+                 << ( reps > 0 ? count / reps : 0.0 );
+          }
+          if ( have_ipc ) {
+            long double cycles = kern->getTotPerfCount(vid, tune_idx, Cycles);
+            long double insts = kern->getTotPerfCount(vid, tune_idx, Instructions);
+            file << sepchr <<right<< setw(datacol_width)
+                 << ( cycles > 0 ? insts / cycles : 0.0 );
+          }
+          for (PerfCounterID pcid : miss_ids) {
+            long double count = kern->getTotPerfCount(vid, tune_idx, pcid);
+            file << sepchr <<right<< setw(datacol_width)
+                 << ( iters > 0 ? count / iters : 0.0 );
+          }
+          file << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+
+void Executor::writeJSONReport(ostream& file)
+{
+  if ( file ) {
+
+    int num_ranks = 1;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+    //
+    // First line describes the run; each following line holds data for
+    // one kernel variant tuning that was run.
+    //
+    file << "{\"record\":\"run\"";
+    file << ",\"num_ranks\":" << num_ranks;
+    file << ",\"reference_variant\":"
+         << ( haveReferenceVariant() ?
+              getJSONString(getVariantName(reference_vid)) : string("null") );
+    file << ",\"reference_tuning\":"
+         << ( haveReferenceVariant() ?
+              getJSONString(tuning_names[reference_vid][reference_tune_idx]) :
+              string("null") );
+    file << ",\"run_params\":";
+    run_params.printJSON(file);
+    file << ",\"timer\":{\"backend\":"
+         << getJSONString(RunParams::TimerBackendToStr(detail::getTimerBackend()))
+         << ",\"resolution\":" << getJSONNumber(detail::getTimerResolution())
+         << ",\"overhead\":" << getJSONNumber(detail::getTimerOverhead()) << "}";
+    for (const RooflinePeaks* peaks : { &seq_roofline, &omp_roofline }) {
+      if ( peaks->calibrated ) {
+        file << ( peaks == &seq_roofline ? ",\"seq_peaks\":{"
+                                         : ",\"omp_peaks\":{" );
+        file << "\"num_threads\":" << peaks->num_threads;
+        for (size_t il = 0; il < peaks->level_names.size(); ++il) {
+          file << "," << getJSONString(peaks->level_names[il] + "_bandwidth")
+               << ":" << getJSONNumber(peaks->level_bandwidth[il]);
+        }
+        file << ",\"flops\":" << getJSONNumber(peaks->flops) << "}";
+      }
+    }
+    file << "}" << endl;
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      // checksums are compared to first variant tuning run, as in
+      // checksum report
+      Checksum_type cksum_ref = 0.0;
+      bool found_ref = false;
+      for (size_t iv = 0; iv < variant_ids.size() && !found_ref; ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t tune_idx = 0;
+             tune_idx < kern->getNumVariantTunings(vid) && !found_ref;
+             ++tune_idx) {
+          if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+            cksum_ref = kern->getChecksum(vid, tune_idx);
+            found_ref = true;
+          }
+        }
+      }
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid);
+             ++tune_idx) {
+
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          file << "{\"record\":\"result\"";
+          file << ",\"kernel\":" << getJSONString(kern->getName());
+          file << ",\"variant\":" << getJSONString(getVariantName(vid));
+          file << ",\"tuning\":"
+               << getJSONString(kern->getVariantTuningName(vid, tune_idx));
+          file << ",\"features\":[";
+          bool first_feature = true;
+          for (size_t ifa = 0; ifa < NumFeatures; ++ifa) {
+            if ( kern->usesFeature(static_cast<FeatureID>(ifa)) ) {
+              file << (first_feature ? "" : ",")
+                   << getJSONString(getFeatureName(static_cast<FeatureID>(ifa)));
+              first_feature = false;
+            }
+          }
+          file << "]";
+          file << ",\"default_problem_size\":" << kern->getDefaultProblemSize();
+          file << ",\"problem_size\":" << kern->getActualProblemSize();
+          file << ",\"reps\":" << kern->getRunReps();
+          file << ",\"reps_run\":"
+               << getJSONNumber(static_cast<long double>(
+                    kern->getTotReps(vid, tune_idx)) / run_params.getNumPasses());
+          file << ",\"its_per_rep\":" << kern->getItsPerRep();
+          file << ",\"kernels_per_rep\":" << kern->getKernelsPerRep();
+          file << ",\"bytes_per_rep\":" << kern->getBytesPerRep();
+          file << ",\"bytes_moved_per_rep\":"
+               << kern->getBytesMovedPerRep(vid, tune_idx);
+          file << ",\"flops_per_rep\":" << kern->getFLOPsPerRep();
+          file << ",\"min_time\":"
+               << getJSONNumber(kern->getMinTime(vid, tune_idx));
+          file << ",\"max_time\":"
+               << getJSONNumber(kern->getMaxTime(vid, tune_idx));
+          file << ",\"avg_time\":"
+               << getJSONNumber(kern->getTotTime(vid, tune_idx) /
+                                run_params.getNumPasses());
+          file << ",\"minor_page_faults\":"
+               << getJSONNumber(static_cast<long double>(
+                    kern->getTotMinorPageFaults(vid, tune_idx)) /
+                    run_params.getNumPasses());
+          file << ",\"major_page_faults\":"
+               << getJSONNumber(static_cast<long double>(
+                    kern->getTotMajorPageFaults(vid, tune_idx)) /
+                    run_params.getNumPasses());
+          file << ",\"checksum\":"
+               << getJSONNumber(kern->getChecksum(vid, tune_idx));
+          file << ",\"checksum_diff\":"
+               << getJSONNumber(cksum_ref - kern->getChecksum(vid, tune_idx));
+
+          vector<double> vals(kern->getSampleTimes(vid, tune_idx));
+          if ( !vals.empty() ) {
+            sort(vals.begin(), vals.end());
+            file << ",\"samples\":{";
+            file << "\"count\":" << vals.size();
+            file << ",\"min\":" << getJSONNumber(vals.front());
+            file << ",\"p5\":" << getJSONNumber(calcPercentile(vals, 5.0));
+            file << ",\"median\":" << getJSONNumber(calcPercentile(vals, 50.0));
+            file << ",\"p95\":" << getJSONNumber(calcPercentile(vals, 95.0));
+            file << ",\"p99\":" << getJSONNumber(calcPercentile(vals, 99.0));
+            file << ",\"max\":" << getJSONNumber(vals.back());
+            file << ",\"mean\":" << getJSONNumber(calcMean(vals));
+            file << ",\"stddev\":" << getJSONNumber(calcStdDev(vals));
+            file << "}";
+          }
+
+          if ( isOpenMPVariant(vid) &&
+               !kern->getOpenMPThreadCPUs().empty() ) {
+            file << ",\"thread_cpus\":[";
+            for (size_t it = 0; it < kern->getOpenMPThreadCPUs().size(); ++it) {
+              file << (it > 0 ? "," : "") << kern->getOpenMPThreadCPUs()[it];
+            }
+            file << "],\"thread_numa_nodes\":[";
+            for (size_t it = 0; it < kern->getOpenMPThreadNUMANodes().size(); ++it) {
+              file << (it > 0 ? "," : "") << kern->getOpenMPThreadNUMANodes()[it];
+            }
+            file << "]";
+          }
+
+          if ( detail::perfCountersOpen() &&
+               kern->getPerfCountsScheduled(vid, tune_idx) ) {
+            file << ",\"counters\":{";
+            bool first_counter = true;
+            for (size_t ipc = 0; ipc < NumPerfCounters; ++ipc) {
+              PerfCounterID pcid = static_cast<PerfCounterID>(ipc);
+              if ( detail::perfCounterOpen(pcid) ) {
+                file << (first_counter ? "" : ",")
+                     << getJSONString(getPerfCounterName(pcid)) << ":"
+                     << getJSONNumber(kern->getTotPerfCount(vid, tune_idx, pcid) /
+                                      run_params.getNumPasses());
+                first_counter = false;
+              }
+            }
+            file << "}";
+          }
+
+          file << "}" << endl;
+        }
+      }
+    }
+
+    //
+    // One line for each kernel variant tuning run in size sweep after the
+    // first size.
+    //
+    for (size_t isw = 0; isw < size_sweep_kernels.size(); ++isw) {
+      for (KernelBase* kern : size_sweep_kernels[isw]) {
+        for (VariantID vid : variant_ids) {
+          for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid);
+               ++tune_idx) {
+
+            if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+              continue;
+            }
+
+            file << "{\"record\":\"size_sweep\"";
+            file << ",\"kernel\":" << getJSONString(kern->getName());
+            file << ",\"variant\":" << getJSONString(getVariantName(vid));
+            file << ",\"tuning\":"
+                 << getJSONString(kern->getVariantTuningName(vid, tune_idx));
+            file << ",\"problem_size\":" << kern->getActualProblemSize();
+            file << ",\"reps\":" << kern->getRunReps();
+            file << ",\"bytes_per_rep\":" << kern->getBytesPerRep();
+            file << ",\"bytes_moved_per_rep\":"
+                 << kern->getBytesMovedPerRep(vid, tune_idx);
+            file << ",\"flops_per_rep\":" << kern->getFLOPsPerRep();
+            file << ",\"min_time\":"
+                 << getJSONNumber(kern->getMinTime(vid, tune_idx));
+            file << ",\"max_time\":"
+                 << getJSONNumber(kern->getMaxTime(vid, tune_idx));
+            file << ",\"avg_time\":"
+                 << getJSONNumber(kern->getTotTime(vid, tune_idx) /
+                                  run_params.getNumPasses());
+            file << ",\"checksum\":"
+                 << getJSONNumber(kern->getChecksum(vid, tune_idx));
+            file << "}" << endl;
+          }
+        }
+      }
+    }
+
+    //
+    // One line for each kernel instance run in a co-run group.
+    //
+    for (const CorunResult& result : corun_results) {
+      const vector<KernelBase*>& kerns = corun_kernels[result.igroup];
+      for (size_t inst = 0; inst < kerns.size(); ++inst) {
+        file << "{\"record\":\"corun\"";
+        file << ",\"group\":" << result.igroup;
+        file << ",\"instance\":" << inst;
+        file << ",\"kernel\":" << getJSONString(kerns[inst]->getName());
+        file << ",\"variant\":" << getJSONString(getVariantName(result.vid));
+        file << ",\"tuning\":"
+             << getJSONString(kerns[inst]->getVariantTuningName(result.vid,
+                                                                result.tune_idx));
+        file << ",\"cpus\":[";
+        const vector<int>& inst_cpus = corun_cpus[result.igroup][inst];
+        for (size_t ic = 0; ic < inst_cpus.size(); ++ic) {
+          file << (ic > 0 ? "," : "") << inst_cpus[ic];
+        }
+        file << "]";
+        file << ",\"bytes_per_rep\":" << kerns[inst]->getBytesPerRep();
+        file << ",\"bytes_moved_per_rep\":"
+             << kerns[inst]->getBytesMovedPerRep(result.vid, result.tune_idx);
+        file << ",\"flops_per_rep\":" << kerns[inst]->getFLOPsPerRep();
+        file << ",\"solo_time_per_rep\":"
+             << getJSONNumber(result.solo_time[inst]);
+        file << ",\"corun_time_per_rep\":"
+             << getJSONNumber(result.corun_time[inst]);
+        file << ",\"corun_reps\":" << getJSONNumber(result.corun_reps[inst]);
+        file << "}" << endl;
+      }
+    }
+
+    //
+    // One line for each OpenMP kernel variant tuning run in thread sweep.
+    //
+    for (size_t isw = 0; isw < sweep_kernels.size(); ++isw) {
+      const int num_threads = run_params.getThreadSweep()[isw];
+      for (KernelBase* kern : sweep_kernels[isw]) {
+        for (VariantID vid : variant_ids) {
+          for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid);
+               ++tune_idx) {
+
+            if ( !isOpenMPVariant(vid) ||
+                 !kern->wasVariantTuningRun(vid, tune_idx) ) {
+              continue;
+            }
+
+            file << "{\"record\":\"thread_sweep\"";
+            file << ",\"kernel\":" << getJSONString(kern->getName());
+            file << ",\"variant\":" << getJSONString(getVariantName(vid));
+            file << ",\"tuning\":"
+                 << getJSONString(kern->getVariantTuningName(vid, tune_idx));
+            file << ",\"num_threads\":" << num_threads;
+            file << ",\"problem_size\":" << kern->getActualProblemSize();
+            file << ",\"min_time\":"
+                 << getJSONNumber(kern->getMinTime(vid, tune_idx));
+            file << ",\"max_time\":"
+                 << getJSONNumber(kern->getMaxTime(vid, tune_idx));
+            file << ",\"avg_time\":"
+                 << getJSONNumber(kern->getTotTime(vid, tune_idx) /
+                                  run_params.getNumPasses());
+            file << ",\"checksum\":"
+                 << getJSONNumber(kern->getChecksum(vid, tune_idx));
+            file << "}" << endl;
+          }
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeThreadSweepReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+    const size_t prec = 6;
+
+    const vector<int>& thread_counts = run_params.getThreadSweep();
+    const bool weak_scaling = run_params.getWeakScaling();
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+
+    vector<string> data_col_names;
+    for (int num_threads : thread_counts) {
+      data_col_names.emplace_back(std::to_string(num_threads) + " threads");
+    }
+
+    size_t datacol_width = prec + 8;
+    for (string const& data_col_name : data_col_names) {
+      datacol_width = max(datacol_width, data_col_name.size());
+    }
+
+    //
+    // Time, speedup, and efficiency tables relative to first thread count.
+    // Strong scaling speedup is t_0/t and efficiency is speedup * n_0/n;
+    // weak scaling efficiency is t_0/t and scaled speedup is
+    // efficiency * n/n_0.
+    //
+    const string base_threads = std::to_string(thread_counts.front());
+    const string titles[] = {
+      string(weak_scaling ? "Weak" : "Strong") +
+        " Scaling Time Report (sec.; average over passes" +
+        (weak_scaling ? "; problem size scaled by number of threads)" : ")"),
+      weak_scaling ?
+        "Weak Scaling Speedup Report (efficiency * threads / " + base_threads + ")" :
+        "Strong Scaling Speedup Report (time with " + base_threads + " threads / time)",
+      weak_scaling ?
+        "Weak Scaling Parallel Efficiency Report (time with " + base_threads + " threads / time)" :
+        "Strong Scaling Parallel Efficiency Report (speedup * " + base_threads + " / threads)" };
+
+    for (size_t itab = 0; itab < 3; ++itab) {
+
+      if ( itab > 0 ) {
+        file << endl;
+      }
+
+      //
+      // Print title line.
+      //
+      file << titles[itab] << endl;
+
+      //
+      // Print column title line.
+      //
+      file <<left<< setw(kercol_width) << kernel_col_name
+           << sepchr <<left<< setw(varcol_width) << variant_col_name
+           << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+      for (string const& data_col_name : data_col_names) {
+        file << sepchr <<left<< setw(datacol_width) << data_col_name;
+      }
+      file << endl;
+
+      //
+      // Print row of data for each OpenMP kernel variant tuning run.
+      //
+      for (size_t ik = 0; ik < kernels.size(); ++ik) {
+        for (VariantID vid : variant_ids) {
+          if ( !isOpenMPVariant(vid) ) {
+            continue;
+          }
+          for (std::string const& tuning_name : tuning_names[vid]) {
+
+            KernelBase* base_kern = sweep_kernels.front()[ik];
+            if ( !base_kern->hasVariantTuningDefined(vid, tuning_name) ) {
+              continue;
+            }
+            size_t tune_idx = base_kern->getVariantTuningIndex(vid, tuning_name);
+            if ( !base_kern->wasVariantTuningRun(vid, tune_idx) ) {
+              continue;
+            }
+            const double base_time = base_kern->getTotTime(vid, tune_idx);
+
+            file <<left<< setw(kercol_width) << base_kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name;
+
+            for (size_t isw = 0; isw < sweep_kernels.size(); ++isw) {
+              KernelBase* kern = sweep_kernels[isw][ik];
+              const double time = kern->getTotTime(vid, tune_idx);
+              const double ratio = ( time > 0.0 ) ? base_time / time : 0.0;
+              const double threads_ratio =
+                static_cast<double>(thread_counts[isw]) / thread_counts.front();
+
+              double val = 0.0;
+              if ( itab == 0 ) {
+                val = time / run_params.getNumPasses();
+              } else if ( itab == 1 ) {
+                val = weak_scaling ? ratio * threads_ratio : ratio;
+              } else {
+                val = weak_scaling ? ratio : ratio / threads_ratio;
+              }
+
+              file << sepchr <<right<< setw(datacol_width)
+                   << setprecision( itab == 0 ? prec : 3 )
+                   << std::fixed << val;
+            }
+            file << endl;
+          }
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
 }
 
-void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
-                              RunParams::CombinerOpt combiner, size_t prec)
+void Executor::writeSizeSweepReport(ostream& file)
 {
   if ( file ) {
 
@@ -999,6 +2680,8 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     // Set basic table formatting parameters.
     //
     const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
     const string sepchr(" , ");
 
     size_t kercol_width = kernel_col_name.size();
@@ -1007,80 +2690,581 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     }
     kercol_width++;
 
-    vector<std::vector<size_t>> vartuncol_width(variant_ids.size());
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      size_t var_width = max(prec+2, getVariantName(variant_ids[iv]).size());
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
       for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
-        vartuncol_width[iv].emplace_back(max(var_width, tuning_name.size()));
+        tuncol_width = max(tuncol_width, tuning_name.size());
       }
     }
 
+    const vector<string> data_col_names = { "Problem size", "Bytes moved/rep",
+                                            "Time/rep (sec.)", "GB/s",
+                                            "GFLOP/s", "Level" };
+    size_t datacol_width = 16;
+    for (string const& data_col_name : data_col_names) {
+      datacol_width = max(datacol_width, data_col_name.size());
+    }
+
+    //
+    // Memory levels for host variants; bytes moved per rep are used as
+    // the working set of a kernel.
+    //
+    vector<string> level_names;
+    vector<double> seq_level_capacity;
+    vector<double> omp_level_capacity;
+    detail::getCacheLevels(1, level_names, seq_level_capacity);
+    int num_omp_threads = 1;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    num_omp_threads = omp_get_max_threads();
+#endif
+    detail::getCacheLevels(num_omp_threads, level_names, omp_level_capacity);
+
     //
     // Print title line.
     //
-    file << getReportTitle(mode, combiner);
+    file << "Size Sweep Report (average over passes; level is fastest host"
+         << " memory level holding bytes moved per rep; boundary marks change"
+         << " in throughput when level changes)" << endl;
 
     //
-    // Wrtie CSV file contents for report.
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& data_col_name : data_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_name;
+    }
+    file << sepchr << "Boundary" << endl;
+
+    //
+    // Print row for each size of each kernel variant tuning run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      for (VariantID vid : variant_ids) {
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kernels[ik]->hasVariantTuningDefined(vid, tuning_name) ) {
+            continue;
+          }
+          size_t tune_idx = kernels[ik]->getVariantTuningIndex(vid, tuning_name);
+
+          const vector<double>* level_capacity = nullptr;
+          if ( isSeqVariant(vid) ) {
+            level_capacity = &seq_level_capacity;
+          } else if ( isOpenMPVariant(vid) ) {
+            level_capacity = &omp_level_capacity;
+          }
+
+          size_t last_level = 0;
+          double last_rate = 0.0;
+
+          for (size_t isz = 0; isz <= size_sweep_kernels.size(); ++isz) {
+            KernelBase* kern = ( isz == 0 ) ? kernels[ik]
+                                            : size_sweep_kernels[isz-1][ik];
+            if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+              continue;
+            }
+
+            const double time_per_rep =
+              kern->getTotTime(vid, tune_idx) / run_params.getNumPasses() /
+              max(kern->getRunReps(), static_cast<Index_type>(1));
+            const double bytes = kern->getBytesMovedPerRep(vid, tune_idx);
+            const double flops = kern->getFLOPsPerRep();
+            const double gbs = ( time_per_rep > 0.0 ) ?
+                               bytes / time_per_rep / 1.0e9 : 0.0;
+            const double gflops = ( time_per_rep > 0.0 ) ?
+                                  flops / time_per_rep / 1.0e9 : 0.0;
+
+            file <<left<< setw(kercol_width) << kern->getName()
+                 << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+                 << sepchr <<left<< setw(tuncol_width) << tuning_name
+                 << sepchr <<right<< setw(datacol_width) << kern->getActualProblemSize()
+                 << sepchr <<right<< setw(datacol_width)
+                 << kern->getBytesMovedPerRep(vid, tune_idx)
+                 << setprecision(6) << std::scientific
+                 << sepchr <<right<< setw(datacol_width) << time_per_rep
+                 << setprecision(3) << std::fixed
+                 << sepchr <<right<< setw(datacol_width) << gbs
+                 << sepchr <<right<< setw(datacol_width) << gflops;
+
+            if ( level_capacity ) {
+              // level holding the data of the kernel
+              size_t level = detail::getCacheLevel(*level_capacity,
+                                                   kern->getBytesPerRep());
+              file << sepchr <<right<< setw(datacol_width) << level_names[level];
+
+              // mark change in throughput (GB/s, or GFLOP/s if no bytes
+              // are moved) when working set moves to a different level
+              double rate = ( bytes > 0.0 ) ? gbs : gflops;
+              if ( isz > 0 && level != last_level && last_rate > 0.0 ) {
+                file << sepchr << level_names[last_level] << "->"
+                     << level_names[level] << " "
+                     << ( bytes > 0.0 ? "GB/s " : "GFLOP/s " )
+                     << std::showpos << setprecision(1)
+                     << 100.0 * (rate - last_rate) / last_rate << "%"
+                     << std::noshowpos;
+              }
+              last_level = level;
+              last_rate = rate;
+            } else {
+              file << sepchr <<right<< setw(datacol_width) << "-";
+            }
+            file << endl;
+          }
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeCorunReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
     //
+    const string group_col_name("Group  ");
+    const string variant_col_name("Variant  ");
+    const string kernel_col_name("Kernel  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    for (const vector<KernelBase*>& kerns : corun_kernels) {
+      for (KernelBase* kern : kerns) {
+        kercol_width = max(kercol_width, kern->getName().size());
+      }
+    }
+    kercol_width++;
 
+    size_t varcol_width = variant_col_name.size();
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-        file << sepchr;
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+    }
+
+    size_t cpucol_width = string("CPUs").size();
+    for (const vector<vector<int>>& group_cpus : corun_cpus) {
+      for (const vector<int>& inst_cpus : group_cpus) {
+        cpucol_width = max(cpucol_width, getCPURangesString(inst_cpus).size());
       }
     }
+
+    const size_t datacol_width = 16;
+
+    //
+    // Print table of each instance.
+    //
+    file << "Co-run Report (instances of each group run at the same time on"
+         << " their own CPUs; times are per rep; slowdown is co-run time /"
+         << " time running alone)" << endl;
+
+    file <<left<< setw(group_col_name.size()) << group_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(datacol_width) << "Instance"
+         << sepchr <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(cpucol_width) << "CPUs";
+    const vector<string> inst_col_names = { "Solo time", "Co-run time",
+                                            "Slowdown", "Solo GB/s",
+                                            "Co-run GB/s" };
+    for (const string& data_col_name : inst_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_name;
+    }
     file << endl;
 
+    for (const CorunResult& result : corun_results) {
+      const vector<KernelBase*>& kerns = corun_kernels[result.igroup];
+      for (size_t inst = 0; inst < kerns.size(); ++inst) {
+        const double bytes =
+          kerns[inst]->getBytesMovedPerRep(result.vid, result.tune_idx);
+        const double solo_time = result.solo_time[inst];
+        const double corun_time = result.corun_time[inst];
+        file <<left<< setw(group_col_name.size()) << result.igroup
+             << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+             << sepchr <<left<< setw(datacol_width) << inst
+             << sepchr <<left<< setw(kercol_width) << kerns[inst]->getName()
+             << sepchr <<left<< setw(cpucol_width)
+             << getCPURangesString(corun_cpus[result.igroup][inst])
+             << setprecision(6) << std::scientific
+             << sepchr <<right<< setw(datacol_width) << solo_time
+             << sepchr <<right<< setw(datacol_width) << corun_time
+             << setprecision(3) << std::fixed
+             << sepchr <<right<< setw(datacol_width)
+             << ( solo_time > 0.0 ? corun_time / solo_time : 0.0 )
+             << sepchr <<right<< setw(datacol_width)
+             << ( solo_time > 0.0 ? bytes / solo_time / 1.0e9 : 0.0 )
+             << sepchr <<right<< setw(datacol_width)
+             << ( corun_time > 0.0 ? bytes / corun_time / 1.0e9 : 0.0 )
+             << endl;
+      }
+    }
+
     //
-    // Print column variant name line.
+    // Print table of aggregate throughput of each group; solo throughput is
+    // the sum for instances running alone, as if they did not interfere.
     //
-    file <<left<< setw(kercol_width) << kernel_col_name;
+    file << endl;
+    file << "Aggregate throughput (co-run throughput is total over instances"
+         << " divided by time of longest instance; efficiency is co-run GB/s"
+         << " (or GFLOP/s if no bytes are moved) / solo)" << endl;
+
+    file <<left<< setw(group_col_name.size()) << group_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(datacol_width) << "Instances";
+    const vector<string> group_col_names = { "Solo GB/s", "Co-run GB/s",
+                                             "Solo GFLOP/s", "Co-run GFLOP/s",
+                                             "Efficiency" };
+    for (const string& data_col_name : group_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_name;
+    }
+    file << endl;
+
+    for (const CorunResult& result : corun_results) {
+      const vector<KernelBase*>& kerns = corun_kernels[result.igroup];
+
+      double solo_gbs = 0.0;
+      double solo_gflops = 0.0;
+      double corun_bytes = 0.0;
+      double corun_flops = 0.0;
+      double corun_max_time = 0.0;
+      for (size_t inst = 0; inst < kerns.size(); ++inst) {
+        const double bytes =
+          kerns[inst]->getBytesMovedPerRep(result.vid, result.tune_idx);
+        const double flops = kerns[inst]->getFLOPsPerRep();
+        if ( result.solo_time[inst] > 0.0 ) {
+          solo_gbs += bytes / result.solo_time[inst] / 1.0e9;
+          solo_gflops += flops / result.solo_time[inst] / 1.0e9;
+        }
+        corun_bytes += bytes * result.corun_reps[inst];
+        corun_flops += flops * result.corun_reps[inst];
+        corun_max_time = max(corun_max_time,
+                             result.corun_time[inst] * result.corun_reps[inst]);
+      }
+      const double corun_gbs = ( corun_max_time > 0.0 ) ?
+                               corun_bytes / corun_max_time / 1.0e9 : 0.0;
+      const double corun_gflops = ( corun_max_time > 0.0 ) ?
+                                  corun_flops / corun_max_time / 1.0e9 : 0.0;
+      double efficiency = 0.0;
+      if ( solo_gbs > 0.0 ) {
+        efficiency = corun_gbs / solo_gbs;
+      } else if ( solo_gflops > 0.0 ) {
+        efficiency = corun_gflops / solo_gflops;
+      }
+
+      file <<left<< setw(group_col_name.size()) << result.igroup
+           << sepchr <<left<< setw(varcol_width) << getVariantName(result.vid)
+           << sepchr <<left<< setw(datacol_width) << kerns.size()
+           << setprecision(3) << std::fixed
+           << sepchr <<right<< setw(datacol_width) << solo_gbs
+           << sepchr <<right<< setw(datacol_width) << corun_gbs
+           << sepchr <<right<< setw(datacol_width) << solo_gflops
+           << sepchr <<right<< setw(datacol_width) << corun_gflops
+           << sepchr <<right<< setw(datacol_width) << efficiency
+           << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeCompareReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-        file << sepchr <<left<< setw(vartuncol_width[iv][it])
-             << getVariantName(variant_ids[iv]);
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
       }
     }
+
+    const vector<string> data_col_names = { "Baseline", "Baseline time",
+                                            "Time", "Ratio", "Per", "Test" };
+    size_t datacol_width = 14;
+    for (string const& data_col_name : data_col_names) {
+      datacol_width = max(datacol_width, data_col_name.size());
+    }
+
+    //
+    // Print title and compare file lines.
+    //
+    file << "Comparison with previous runs (time is average per rep, or per"
+         << " pass if reps of previous run are unknown; ratio is time / baseline"
+         << " time; regression if significantly slower and ratio exceeds "
+         << 1.0 + run_params.getCompareThreshold() / 100.0 << ")" << endl;
+    for (size_t ibase = 0; ibase < num_baseline_results.size(); ++ibase) {
+      file << "Baseline " << ibase << sepchr
+           << run_params.getCompareFiles()[ibase] << sepchr
+           << num_baseline_results[ibase] << " results" << endl;
+    }
     file << endl;
 
     //
-    // Print column tuning name line.
+    // Print column title line.
     //
-    file <<left<< setw(kercol_width) << kernel_col_name;
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& data_col_name : data_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_name;
+    }
+    file << sepchr << "Result" << endl;
+
+    //
+    // Print row for each comparison.
+    //
+    for (const BaselineComparison& comp : baseline_comparisons) {
+      file <<left<< setw(kercol_width) << comp.kern->getName()
+           << sepchr <<left<< setw(varcol_width) << getVariantName(comp.vid)
+           << sepchr <<left<< setw(tuncol_width)
+           << comp.kern->getVariantTuningName(comp.vid, comp.tune_idx)
+           << sepchr <<right<< setw(datacol_width) << comp.ibase
+           << setprecision(6) << std::scientific
+           << sepchr <<right<< setw(datacol_width) << comp.base_time
+           << sepchr <<right<< setw(datacol_width) << comp.time
+           << setprecision(3) << std::fixed
+           << sepchr <<right<< setw(datacol_width) << comp.ratio
+           << sepchr <<right<< setw(datacol_width)
+           << ( comp.per_rep ? "rep" : "pass" )
+           << sepchr <<right<< setw(datacol_width) << comp.test
+           << sepchr << comp.result << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writeAffinityReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string threads_col_name("Threads");
+    const string sepchr(" , ");
+
+    size_t kercol_width = kernel_col_name.size();
+    size_t max_threads = 0;
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+      max_threads = max(max_threads, kernels[ik]->getOpenMPThreadCPUs().size());
+    }
+    kercol_width++;
+
+    const size_t datacol_width = 12;
+
+    //
+    // Print title line.
+    //
+    file << "OpenMP Thread Placement Report (CPU:NUMA node of each thread;"
+         << " binding = "
+         << RunParams::ThreadBindingToStr(run_params.getThreadBinding())
+         << ")" << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(threads_col_name.size()) << threads_col_name;
+    for (size_t it = 0; it < max_threads; ++it) {
+      file << sepchr <<left<< setw(datacol_width)
+           << ("Thread " + std::to_string(it));
+    }
+    file << endl;
+
+    //
+    // Print row of thread placement for each kernel with OpenMP variants run.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      const vector<int>& cpus = kern->getOpenMPThreadCPUs();
+      const vector<int>& nodes = kern->getOpenMPThreadNUMANodes();
+      if ( cpus.empty() ) {
+        continue;
+      }
+
+      file <<left<< setw(kercol_width) << kern->getName()
+           << sepchr <<right<< setw(threads_col_name.size()) << cpus.size();
+      for (size_t it = 0; it < cpus.size(); ++it) {
+        file << sepchr <<right<< setw(datacol_width)
+             << (std::to_string(cpus[it]) + ":" + std::to_string(nodes[it]));
+      }
+      file << endl;
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::calibrateRoofline()
+{
+  bool have_seq = false;
+  bool have_omp = false;
+  for (VariantID vid : variant_ids) {
+    have_seq = have_seq || isSeqVariant(vid);
+    have_omp = have_omp || isOpenMPVariant(vid);
+  }
+
+  getCout() << "\n\nMeasure machine peaks for roofline report...\n";
+
+  if ( have_seq ) {
+    detail::calibrateRoofline(seq_roofline, 1);
+  }
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( have_omp ) {
+    detail::calibrateRoofline(omp_roofline, omp_get_max_threads());
+  }
+#endif
+}
+
+void Executor::writeRooflineReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string tuning_col_name("Tuning  ");
+    const string sepchr(" , ");
+    const size_t prec = 3;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    size_t tuncol_width = tuning_col_name.size();
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-        file << sepchr <<left<< setw(vartuncol_width[iv][it])
-             << tuning_names[variant_ids[iv]][it];
+      varcol_width = max(varcol_width, getVariantName(variant_ids[iv]).size());
+      for (std::string const& tuning_name : tuning_names[variant_ids[iv]]) {
+        tuncol_width = max(tuncol_width, tuning_name.size());
+      }
+    }
+
+    const vector<string> data_col_names{ "FLOP/byte", "GB/s", "GFLOP/s",
+                                         "Mem level", "Level GB/s",
+                                         "Peak GFLOP/s", "Pct of roofline" };
+    size_t datacol_width = 0;
+    for (string const& data_col_name : data_col_names) {
+      datacol_width = max(datacol_width, data_col_name.size());
+    }
+
+    //
+    // Print title line and measured machine peaks.
+    //
+    file << "Roofline Report (sequential and OpenMP variants)" << endl;
+
+    for (const RooflinePeaks* peaks : { &seq_roofline, &omp_roofline }) {
+      if ( peaks->calibrated ) {
+        file << ( peaks == &seq_roofline ? "Sequential" : "OpenMP" )
+             << " peaks (" << peaks->num_threads << " threads)"
+             << setprecision(prec) << std::fixed;
+        for (size_t il = 0; il < peaks->level_names.size(); ++il) {
+          file << sepchr << peaks->level_names[il] << " GB/s = "
+               << peaks->level_bandwidth[il] / 1.0e9;
+        }
+        file << sepchr << "GFLOP/s = " << peaks->flops / 1.0e9 << endl;
       }
     }
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name
+         << sepchr <<left<< setw(tuncol_width) << tuning_col_name;
+    for (string const& data_col_name : data_col_names) {
+      file << sepchr <<left<< setw(datacol_width) << data_col_name;
+    }
     file << endl;
 
     //
-    // Print row of data for variants of each kernel.
+    // Print row of roofline data for each host kernel variant tuning run.
+    // The memory level used for a kernel is the fastest one that holds the
+    // bytes it moves each rep.
     //
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       KernelBase* kern = kernels[ik];
-      file <<left<< setw(kercol_width) << kern->getName();
       for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
         VariantID vid = variant_ids[iv];
-        for (size_t it = 0; it < tuning_names[variant_ids[iv]].size(); ++it) {
-          std::string const& tuning_name = tuning_names[variant_ids[iv]][it];
-          file << sepchr <<right<< setw(vartuncol_width[iv][it]);
-          if ( (mode == CSVRepMode::Speedup) &&
-               (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
-                !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
-            file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
-                      !kern->hasVariantTuningDefined(vid, tuning_name) ) {
-            file << "Not run";
-          } else {
-            file << setprecision(prec) << std::fixed
-                 << getReportDataEntry(mode, combiner, kern, vid,
-                        kern->getVariantTuningIndex(vid, tuning_name));
+
+        const RooflinePeaks* peaks = nullptr;
+        if ( isSeqVariant(vid) ) {
+          peaks = &seq_roofline;
+        } else if ( isOpenMPVariant(vid) ) {
+          peaks = &omp_roofline;
+        }
+        if ( !peaks || !peaks->calibrated ) {
+          continue;
+        }
+
+        for (std::string const& tuning_name : tuning_names[vid]) {
+
+          if ( !kern->hasVariantTuningDefined(vid, tuning_name) ||
+               kern->getRunReps() <= 0 ) {
+            continue;
           }
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_name);
+
+          double time = kern->getTotTime(vid, tune_idx) /
+                        run_params.getNumPasses() / kern->getRunReps();
+          double bytes = kern->getBytesMovedPerRep(vid, tune_idx);
+          double flops = kern->getFLOPsPerRep();
+
+          // level holding the data of the kernel
+          size_t level = peaks->getLevel(kern->getBytesPerRep());
+          double level_bw = peaks->level_bandwidth[level];
+
+          double roof_time = max(bytes / level_bw, flops / peaks->flops);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width) << getVariantName(vid)
+               << sepchr <<left<< setw(tuncol_width) << tuning_name
+               << setprecision(prec) << std::fixed
+               << sepchr <<right<< setw(datacol_width)
+               << ( bytes > 0.0 ? flops / bytes : 0.0 )
+               << sepchr <<right<< setw(datacol_width)
+               << ( time > 0.0 ? bytes / time / 1.0e9 : 0.0 )
+               << sepchr <<right<< setw(datacol_width)
+               << ( time > 0.0 ? flops / time / 1.0e9 : 0.0 )
+               << sepchr <<right<< setw(datacol_width)
+               << peaks->level_names[level]
+               << sepchr <<right<< setw(datacol_width) << level_bw / 1.0e9
+               << sepchr <<right<< setw(datacol_width) << peaks->flops / 1.0e9
+               << sepchr <<right<< setw(datacol_width)
+               << ( time > 0.0 ? 100.0 * roof_time / time : 0.0 ) << endl;
         }
       }
-      file << endl;
     }
 
     file.flush();
@@ -1635,6 +3819,18 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       }
       break;
     }
+    case CSVRepMode::Reps : {
+      title += string("Reps Report (reps run per pass) ");
+      break;
+    }
+    case CSVRepMode::MinorPageFaults : {
+      title += string("Minor Page Faults Report (faults while running per pass) ");
+      break;
+    }
+    case CSVRepMode::MajorPageFaults : {
+      title += string("Major Page Faults Report (faults while running per pass) ");
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return title;
@@ -1702,6 +3898,21 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
       }
       break;
     }
+    case CSVRepMode::Reps : {
+      retval = static_cast<long double>(kern->getTotReps(vid, tune_idx)) /
+               run_params.getNumPasses();
+      break;
+    }
+    case CSVRepMode::MinorPageFaults : {
+      retval = static_cast<long double>(kern->getTotMinorPageFaults(vid, tune_idx)) /
+               run_params.getNumPasses();
+      break;
+    }
+    case CSVRepMode::MajorPageFaults : {
+      retval = static_cast<long double>(kern->getTotMajorPageFaults(vid, tune_idx)) /
+               run_params.getNumPasses();
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return retval;
@@ -11,6 +11,7 @@
 
 #include "common/RAJAPerfSuite.hpp"
 #include "common/RunParams.hpp"
+#include "common/Roofline.hpp"
 
 #include <iosfwd>
 #include <streambuf>
@@ -46,12 +47,18 @@ public:
 
   void outputRunData();
 
+  // non-zero if a regression was found relative to a previous run
+  int getExitStatus() const { return exit_status; }
+
 private:
   Executor() = delete;
 
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    Reps,
+    MinorPageFaults,
+    MajorPageFaults,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -60,16 +67,45 @@ private:
     std::vector<VariantID> variants;
   };
 
+  struct BaselineComparison {
+    size_t ibase;          // index of compare file
+    KernelBase* kern;
+    VariantID vid;
+    size_t tune_idx;
+    bool per_rep;          // times are per rep, else per pass
+    double base_time;      // sec.
+    double time;           // sec.
+    double ratio;          // time / base_time
+    std::string test;      // how significance was tested
+    std::string result;
+  };
+
+  struct CorunResult {
+    size_t igroup;         // index of co-run group
+    VariantID vid;
+    size_t tune_idx;
+    std::vector<double> solo_time;   // sec. per rep of each instance alone
+    std::vector<double> corun_time;  // sec. per rep of each instance in co-run
+    std::vector<double> corun_reps;  // reps per pass of each instance in co-run
+  };
+
   template < typename Kernel >
   KernelBase* makeKernel();
 
-  void runKernel(KernelBase* kern, bool print_kernel_name);
+  void runKernel(KernelBase* kern, bool print_kernel_name,
+                 const std::vector<VariantID>& vids);
+
+  void runThreadSweep();
+  void runSizeSweep();
+  void runCorun();
+  void runCorunVariant(size_t igroup, VariantID vid);
 
   std::unique_ptr<std::ostream> openOutputFile(const std::string& filename) const;
 
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
 
-  void writeKernelInfoSummary(std::ostream& str, bool to_file) const;
+  void writeKernelInfoSummary(std::ostream& str, bool to_file,
+                              bool show_footprint) const;
 
   void writeCSVReport(std::ostream& file, CSVRepMode mode,
                       RunParams::CombinerOpt combiner, size_t prec);
@@ -82,6 +118,28 @@ private:
   void writeFOMReport(std::ostream& file, std::vector<FOMGroup>& fom_groups);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
 
+  void writeSamplesReport(std::ostream& file);
+  void writeHistogramReport(std::ostream& file);
+
+  void writePerfCountersReport(std::ostream& file);
+
+  void writeJSONReport(std::ostream& file);
+
+  void writeAffinityReport(std::ostream& file);
+
+  void writeThreadSweepReport(std::ostream& file);
+  void writeSizeSweepReport(std::ostream& file);
+
+  void writeCorunReport(std::ostream& file);
+
+  void compareBaselines();
+  void writeCompareReport(std::ostream& file);
+
+  void calibrateRoofline();
+  void writeRooflineReport(std::ostream& file);
+
+  void estimateDataFootprints();
+
   RunParams run_params;
   std::vector<KernelBase*> kernels;
   std::vector<VariantID>   variant_ids;
@@ -90,6 +148,32 @@ private:
   VariantID reference_vid;
   size_t    reference_tune_idx;
 
+  RooflinePeaks seq_roofline;
+  RooflinePeaks omp_roofline;
+
+  // run params and kernels for each thread count in thread sweep
+  std::vector<std::unique_ptr<RunParams>> sweep_params;
+  std::vector<std::vector<KernelBase*>> sweep_kernels;
+
+  // run params and kernels for each size in size sweep after the first,
+  // which is the size of the main run
+  std::vector<std::unique_ptr<RunParams>> size_sweep_params;
+  std::vector<std::vector<KernelBase*>> size_sweep_kernels;
+
+  // kernel instances of each co-run group, with the CPUs and run params
+  // of each instance (reps are scaled so instances run equally long)
+  std::vector<std::vector<KernelBase*>> corun_kernels;
+  std::vector<std::vector<std::vector<int>>> corun_cpus;
+  std::vector<std::vector<std::unique_ptr<RunParams>>> corun_params;
+  std::vector<CorunResult> corun_results;
+
+  // number of results read from each compare file, and comparison of
+  // each kernel variant tuning run with matching result
+  std::vector<size_t> num_baseline_results;
+  std::vector<BaselineComparison> baseline_comparisons;
+
+  int exit_status;
+
 public:
   // Methods for verification testing in CI.
   std::vector<KernelBase*> getKernels() const { return kernels; }
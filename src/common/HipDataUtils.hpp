@@ -103,7 +103,7 @@ __device__ inline Index_type lambda_hip_get_index<RAJA::hip_block_z_direct>() {
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void initHipDeviceData(T& dptr, const T hptr, int len)
+void initHipDeviceData(T& dptr, const T hptr, Index_type len)
 {
   hipErrchk( hipMemcpy( dptr, hptr,
                           len * sizeof(typename std::remove_pointer<T>::type),
@@ -116,21 +116,27 @@ void initHipDeviceData(T& dptr, const T hptr, int len)
  * \brief Allocate HIP device data array (dptr).
  */
 template <typename T>
-void allocHipDeviceData(T& dptr, int len)
+void allocHipDeviceData(T& dptr, Index_type len)
 {
   hipErrchk( hipMalloc( (void**)&dptr,
               len * sizeof(typename std::remove_pointer<T>::type) ) );
+  detail::recordDataAlloc(dptr,
+                          len * sizeof(typename std::remove_pointer<T>::type),
+                          detail::DataSpace::Device);
 }
 
 /*!
  * \brief Allocate HIP pinned data array (pptr).
  */
 template <typename T>
-void allocHipPinnedData(T& pptr, int len)
+void allocHipPinnedData(T& pptr, Index_type len)
 {
   hipErrchk( hipHostMalloc( (void**)&pptr,
               len * sizeof(typename std::remove_pointer<T>::type),
               hipHostMallocMapped ) );
+  detail::recordDataAlloc(pptr,
+                          len * sizeof(typename std::remove_pointer<T>::type),
+                          detail::DataSpace::Pinned);
 }
 
 /*!
@@ -138,7 +144,7 @@ void allocHipPinnedData(T& pptr, int len)
  * data to device array.
  */
 template <typename T>
-void allocAndInitHipDeviceData(T& dptr, const T hptr, int len)
+void allocAndInitHipDeviceData(T& dptr, const T hptr, Index_type len)
 {
   allocHipDeviceData(dptr, len);
   initHipDeviceData(dptr, hptr, len);
@@ -151,7 +157,7 @@ void allocAndInitHipDeviceData(T& dptr, const T hptr, int len)
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void getHipDeviceData(T& hptr, const T dptr, int len)
+void getHipDeviceData(T& hptr, const T dptr, Index_type len)
 {
   hipErrchk( hipMemcpy( hptr, dptr,
               len * sizeof(typename std::remove_pointer<T>::type),
@@ -164,6 +170,7 @@ void getHipDeviceData(T& hptr, const T dptr, int len)
 template <typename T>
 void deallocHipDeviceData(T& dptr)
 {
+  detail::recordDataDealloc(dptr);
   hipErrchk( hipFree( dptr ) );
   dptr = nullptr;
 }
@@ -174,6 +181,7 @@ void deallocHipDeviceData(T& dptr)
 template <typename T>
 void deallocHipPinnedData(T& pptr)
 {
+  detail::recordDataDealloc(pptr);
   hipErrchk( hipHostFree( pptr ) );
   pptr = nullptr;
 }
@@ -8,11 +8,17 @@
 
 #include "KernelBase.hpp"
 
+#include "AffinityUtils.hpp"
+#include "CacheUtils.hpp"
 #include "RunParams.hpp"
+#include "StatUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
+#include <sys/resource.h>
+
 namespace rajaperf {
 
 KernelBase::KernelBase(KernelID kid, const RunParams& params) :
@@ -30,6 +36,10 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
     uses_feature[fid] = false;
   }
 
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    omp_schedule_tune_idx_begin[vid] = getUnknownTuningIdx();
+  }
+
   its_per_rep = -1;
   kernels_per_rep = -1;
   bytes_per_rep = -1;
@@ -38,6 +48,24 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   running_variant = NumVariants;
   running_tuning = getUnknownTuningIdx();
 
+  running_reps = -1;
+  running_rep_offset = 0;
+  running_num_reps = 0;
+  running_num_samples = 0;
+  running_minor_faults = 0;
+  running_major_faults = 0;
+
+  peak_rss_bytes = 0;
+
+  running_time = 0.0;
+  last_time = 0.0;
+
+  count_perf_events = false;
+  running_perf_scheduled = true;
+  for (size_t ipc = 0; ipc < NumPerfCounters; ++ipc) {
+    running_perf_counts[ipc] = 0.0;
+  }
+
   checksum_scale_factor = 1.0;
 }
 
@@ -61,6 +89,10 @@ Index_type KernelBase::getTargetProblemSize() const
 
 Index_type KernelBase::getRunReps() const
 {
+  if (running_reps >= 0) {
+    return running_reps;
+  }
+
   Index_type run_reps = static_cast<Index_type>(0);
   if (run_params.getInputState() == RunParams::CheckRun) {
     run_reps = static_cast<Index_type>(run_params.getCheckRunReps());
@@ -91,6 +123,14 @@ void KernelBase::setVariantDefined(VariantID vid)
       break;
     }
 
+    case Base_SIMD :
+    {
+#if defined(RUN_SIMD)
+      setSIMDTuningDefinitions(vid);
+#endif
+      break;
+    }
+
     case Base_OpenMP :
     case Lambda_OpenMP :
     case RAJA_OpenMP :
@@ -151,6 +191,12 @@ void KernelBase::setVariantDefined(VariantID vid)
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
   tot_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  sample_times[vid].resize(variant_tuning_names[vid].size());
+  tot_reps[vid].resize(variant_tuning_names[vid].size(), 0);
+  tot_perf_counts[vid].resize(variant_tuning_names[vid].size());
+  perf_counts_scheduled[vid].resize(variant_tuning_names[vid].size(), true);
+  tot_minor_faults[vid].resize(variant_tuning_names[vid].size(), 0);
+  tot_major_faults[vid].resize(variant_tuning_names[vid].size(), 0);
 }
 
 void KernelBase::execute(VariantID vid, size_t tune_idx)
@@ -158,31 +204,223 @@ void KernelBase::execute(VariantID vid, size_t tune_idx)
   running_variant = vid;
   running_tuning = tune_idx;
 
-  resetTimer();
+  running_time = 0.0;
+  running_num_reps = 0;
+  running_num_samples = 0;
+  running_minor_faults = 0;
+  running_major_faults = 0;
+  running_sample_times.clear();
+
+  count_perf_events = detail::perfCountingEnabled();
+  running_perf_scheduled = true;
+  for (size_t ipc = 0; ipc < NumPerfCounters; ++ipc) {
+    running_perf_counts[ipc] = 0.0;
+  }
+
+  if ( vid == Base_OpenMP || vid == Lambda_OpenMP || vid == RAJA_OpenMP ) {
+    detail::bindOpenMPThreads();
+    if ( omp_thread_cpus.empty() ) {
+      detail::getOpenMPThreadPlacement(omp_thread_cpus, omp_thread_numa_nodes);
+    }
+    setOpenMPSchedule(vid, tune_idx);
+  }
 
   detail::resetDataInitCount();
+  detail::setDataFootprint(&data_footprint);
   this->setUp(vid, tune_idx);
 
-  this->runKernel(vid, tune_idx);
+  if ( start_hook ) {
+    start_hook();
+  }
 
+  //
+  // Run kernel reps in separately timed samples of at most sample_reps
+  // reps each; all reps are timed as one sample by default.
+  //
+  const Index_type run_reps = getRunReps();
+  Index_type sample_reps = run_reps;
+  if ( run_params.getSampleReps() > 0 ) {
+    sample_reps = std::min(run_reps,
+                           static_cast<Index_type>(run_params.getSampleReps()));
+  } else if ( run_params.getAdaptiveReps() ) {
+    sample_reps = std::max(run_reps / adaptive_samples_per_run,
+                           static_cast<Index_type>(1));
+  }
+  if ( run_params.getCacheMode() == RunParams::CacheMode::ColdCache ) {
+    // each rep is timed alone after caches are scrubbed
+    sample_reps = std::min(run_reps, static_cast<Index_type>(1));
+  }
+
+  //
+  // With adaptive reps, only a fixed number of samples is run before the
+  // checksum is computed so checksums do not depend on timing variations.
+  //
+  Index_type check_reps = run_reps;
+  if ( run_params.getAdaptiveReps() ) {
+    check_reps = std::min(run_reps, adaptive_min_samples*sample_reps);
+  }
+
+  do {
+    runSample(vid, tune_idx, run_reps,
+              std::min(sample_reps, check_reps - running_num_reps));
+  } while ( running_num_reps < check_reps );
+
+  // checksum all data with the nominal number of reps, not the last sample
+  running_reps = -1;
+  running_rep_offset = 0;
   this->updateChecksum(vid, tune_idx);
 
+  if ( run_params.getAdaptiveReps() && run_reps > 0 ) {
+    while ( !isTimingConverged() ) {
+      runSample(vid, tune_idx, run_reps, sample_reps);
+    }
+  }
+
+  running_reps = -1;
+  running_rep_offset = 0;
+
+  if ( running_num_samples > 0 ) {
+    // report time for nominal number of reps when a different number was run
+    if ( running_num_reps > 0 && running_num_reps != run_reps ) {
+      running_time *= static_cast<double>(run_reps) / running_num_reps;
+    }
+    recordExecTime();
+  }
+
   this->tearDown(vid, tune_idx);
+  detail::setDataFootprint(nullptr);
+
+  peak_rss_bytes = std::max(peak_rss_bytes, detail::getPeakRSSBytes());
+
+  count_perf_events = false;
 
   running_variant = NumVariants;
   running_tuning = getUnknownTuningIdx();
 }
 
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+void KernelBase::addOpenMPScheduleTuningNames(VariantID vid)
+{
+  omp_schedule_tune_idx_begin[vid] = variant_tuning_names[vid].size();
+  for (const RunParams::OpenMPSchedule& sched : run_params.getOpenMPSchedules()) {
+    addVariantTuningName(vid, RunParams::OpenMPScheduleToStr(sched));
+  }
+}
+#endif
+
+void KernelBase::setOpenMPSchedule(VariantID vid, size_t tune_idx) const
+{
+  RunParams::OpenMPSchedule sched{RunParams::OpenMPScheduleKind::StaticSchedule, 0};
+  if ( tune_idx >= omp_schedule_tune_idx_begin[vid] ) {
+    sched = run_params.getOpenMPSchedules().at(tune_idx -
+                                               omp_schedule_tune_idx_begin[vid]);
+  }
+  detail::setOpenMPSchedule(sched);
+}
+
+void KernelBase::measureDataFootprint(VariantID vid, size_t tune_idx)
+{
+  data_footprint = detail::DataFootprint();
+
+  detail::resetDataInitCount();
+  detail::setDataFootprint(&data_footprint);
+  this->setUp(vid, tune_idx);
+  this->tearDown(vid, tune_idx);
+  detail::setDataFootprint(nullptr);
+}
+
+void KernelBase::runSample(VariantID vid, size_t tune_idx,
+                           Index_type run_reps, Index_type sample_reps)
+{
+  //
+  // Reps past the nominal number wrap around to the start so kernels
+  // that use separate data for each rep stay within their data. Samples
+  // end at the wrap point, so data is reset there for kernels that modify
+  // it in place, with the nominal number of reps.
+  //
+  running_rep_offset = ( run_reps > 0 ) ? running_num_reps % run_reps : 0;
+  if ( running_num_reps > 0 && running_rep_offset == 0 ) {
+    running_reps = -1;
+    this->resetData(vid, tune_idx);
+  }
+  running_reps = std::min(sample_reps, run_reps - running_rep_offset);
+
+  if ( run_params.getCacheMode() == RunParams::CacheMode::ColdCache ) {
+    detail::scrubCaches();
+  }
+
+  struct rusage usage_start;
+  getrusage(RUSAGE_SELF, &usage_start);
+
+  resetTimer();
+  this->runKernel(vid, tune_idx);
+
+  struct rusage usage_stop;
+  getrusage(RUSAGE_SELF, &usage_stop);
+  running_minor_faults += usage_stop.ru_minflt - usage_start.ru_minflt;
+  running_major_faults += usage_stop.ru_majflt - usage_start.ru_majflt;
+
+  running_num_reps += running_reps;
+}
+
+bool KernelBase::isTimingConverged() const
+{
+  int converged = ( running_time >= run_params.getCIMaxTime() );
+
+  if ( !converged && running_sample_times.size() >= 2 ) {
+    double mean = calcMean(running_sample_times);
+    double half_width = calcConfidenceHalfWidth(running_sample_times);
+    converged = ( half_width <= 0.01*run_params.getCITarget()*mean );
+  }
+
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  // all ranks must run the same number of samples
+  int all_converged = converged;
+  MPI_Allreduce(&converged, &all_converged, 1, MPI_INT, MPI_MIN,
+                MPI_COMM_WORLD);
+  converged = all_converged;
+#endif
+
+  return converged;
+}
+
+void KernelBase::recordSampleTime()
+{
+  RAJA::Timer::ElapsedType sample_time = timer.elapsed();
+
+  running_time += sample_time;
+  running_num_samples++;
+
+  if ( running_reps > 0 ) {
+    running_sample_times.emplace_back(sample_time / running_reps);
+    if ( run_params.getSampleReps() > 0 ) {
+      sample_times[running_variant].at(running_tuning).emplace_back(
+          sample_time / running_reps);
+    }
+  }
+}
+
 void KernelBase::recordExecTime()
 {
   num_exec[running_variant].at(running_tuning)++;
 
-  RAJA::Timer::ElapsedType exec_time = timer.elapsed();
+  RAJA::Timer::ElapsedType exec_time = running_time;
+  last_time = exec_time;
   min_time[running_variant].at(running_tuning) =
       std::min(min_time[running_variant].at(running_tuning), exec_time);
   max_time[running_variant].at(running_tuning) =
       std::max(max_time[running_variant].at(running_tuning), exec_time);
   tot_time[running_variant].at(running_tuning) += exec_time;
+  tot_reps[running_variant].at(running_tuning) += running_num_reps;
+  tot_minor_faults[running_variant].at(running_tuning) += running_minor_faults;
+  tot_major_faults[running_variant].at(running_tuning) += running_major_faults;
+  for (size_t ipc = 0; ipc < NumPerfCounters; ++ipc) {
+    tot_perf_counts[running_variant].at(running_tuning)[ipc] +=
+        running_perf_counts[ipc];
+  }
+  if ( !running_perf_scheduled ) {
+    perf_counts_scheduled[running_variant].at(running_tuning) = false;
+  }
 }
 
 void KernelBase::runKernel(VariantID vid, size_t tune_idx)
@@ -208,6 +446,14 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
       break;
     }
 
+    case Base_SIMD :
+    {
+#if defined(RUN_SIMD)
+      runSIMDVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
     case Base_OpenMP :
     case Lambda_OpenMP :
     case RAJA_OpenMP :
@@ -14,6 +14,9 @@
 #include "common/DataUtils.hpp"
 #include "common/RunParams.hpp"
 #include "common/GPUUtils.hpp"
+#include "common/OpenMPUtils.hpp"
+#include "common/PerfCounters.hpp"
+#include "common/TimerUtils.hpp"
 
 #include "RAJA/util/Timer.hpp"
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
@@ -30,6 +33,8 @@
 #include <vector>
 #include <iostream>
 #include <limits>
+#include <array>
+#include <functional>
 
 namespace rajaperf {
 
@@ -74,10 +79,25 @@ public:
 
   virtual void setSeqTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
+#if defined(RUN_SIMD)
+  virtual void setSIMDTuningDefinitions(VariantID vid)
+  { addVariantTuningName(vid, getDefaultTuningName()); }
+#endif
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   virtual void setOpenMPTuningDefinitions(VariantID vid)
-  { addVariantTuningName(vid, getDefaultTuningName()); }
+  {
+    addVariantTuningName(vid, getDefaultTuningName());
+    addOpenMPScheduleTuningNames(vid);
+  }
+  // add a tuning for each OpenMP schedule given in run params; loops with
+  // schedule(runtime) run with that schedule
+  void addOpenMPScheduleTuningNames(VariantID vid);
 #endif
+  // whether tuning is an OpenMP schedule tuning; kernels run those with
+  // schedule(runtime) loops and RAJA policies, and other tunings with the
+  // loops and policies they use without schedule tunings
+  bool isOpenMPScheduleTuning(VariantID vid, size_t tune_idx) const
+  { return tune_idx >= omp_schedule_tune_idx_begin[vid]; }
 #if defined(RAJA_ENABLE_CUDA)
   virtual void setCudaTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
@@ -107,9 +127,18 @@ public:
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
+  // bytes moved to and from memory each rep by given variant tuning, for
+  // tunings whose traffic differs from the data touched (bytes per rep)
+  virtual Index_type getBytesMovedPerRep(VariantID RAJAPERF_UNUSED_ARG(vid),
+                                         size_t RAJAPERF_UNUSED_ARG(tune_idx)) const
+  { return getBytesPerRep(); }
 
   Index_type getTargetProblemSize() const;
+  // reps to run in current timing sample while a variant is executing,
+  // else total reps to run in each kernel execution
   Index_type getRunReps() const;
+  // number of reps run before current timing sample in kernel execution
+  Index_type getRunRepOffset() const { return running_rep_offset; }
 
   bool usesFeature(FeatureID fid) const { return uses_feature[fid]; };
 
@@ -160,7 +189,7 @@ public:
     }
 
   // get runtime of executed variant/tuning
-  double getLastTime() const { return timer.elapsed(); }
+  double getLastTime() const { return last_time; }
 
   // get timers accumulated over npasses
   double getMinTime(VariantID vid, size_t tune_idx) const { return min_time[vid].at(tune_idx); }
@@ -168,8 +197,49 @@ public:
   double getTotTime(VariantID vid, size_t tune_idx) { return tot_time[vid].at(tune_idx); }
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const { return checksum[vid].at(tune_idx); }
 
+  // get number of reps run, accumulated over npasses
+  Index_type getTotReps(VariantID vid, size_t tune_idx) const { return tot_reps[vid].at(tune_idx); }
+
+  // get page faults while running kernel, accumulated over npasses
+  long getTotMinorPageFaults(VariantID vid, size_t tune_idx) const { return tot_minor_faults[vid].at(tune_idx); }
+  long getTotMajorPageFaults(VariantID vid, size_t tune_idx) const { return tot_major_faults[vid].at(tune_idx); }
+
+  // get CPU and NUMA node of each OpenMP thread, captured when first
+  // OpenMP variant is run (empty if none was run)
+  const std::vector<int>& getOpenMPThreadCPUs() const { return omp_thread_cpus; }
+  const std::vector<int>& getOpenMPThreadNUMANodes() const { return omp_thread_numa_nodes; }
+
+  // get hardware counter events, accumulated over npasses
+  long double getTotPerfCount(VariantID vid, size_t tune_idx, PerfCounterID pcid) const
+    { return tot_perf_counts[vid].at(tune_idx)[pcid]; }
+  // whether counter group was scheduled each time kernel was timed, so
+  // counts are complete
+  bool getPerfCountsScheduled(VariantID vid, size_t tune_idx) const
+    { return perf_counts_scheduled[vid].at(tune_idx); }
+
+  // get per-rep times of timing samples accumulated over npasses
+  // (only recorded when run with timing samples)
+  const std::vector<double>& getSampleTimes(VariantID vid, size_t tune_idx) const
+    { return sample_times[vid].at(tune_idx); }
+
+  // get bytes of data allocated by kernel in each data space and peak
+  // resident set size of process after kernel ran (estimates in dry run)
+  const detail::DataFootprint& getDataFootprint() const { return data_footprint; }
+  size_t getPeakRSSBytes() const { return peak_rss_bytes; }
+  void setDataFootprintEstimate(const detail::DataFootprint& footprint,
+                                size_t rss_bytes)
+    { data_footprint = footprint; peak_rss_bytes = rss_bytes; }
+
   void execute(VariantID vid, size_t tune_idx);
 
+  // set up and tear down given variant tuning without running it, counting
+  // data it allocates in a fresh footprint
+  void measureDataFootprint(VariantID vid, size_t tune_idx);
+
+  // set function called by execute after setUp and before reps are timed,
+  // e.g. to start concurrently run kernels together
+  void setStartHook(std::function<void()> hook) { start_hook = std::move(hook); }
+
   void synchronize()
   {
 #if defined(RAJA_ENABLE_CUDA)
@@ -190,31 +260,31 @@ public:
 
   int getDataAlignment() const { return run_params.getDataAlignment(); }
   template <typename T>
-  void allocData(T*& ptr, int len,
+  void allocData(T*& ptr, Index_type len,
                  VariantID vid)
   {
     rajaperf::detail::allocData(ptr, len, getDataAlignment(), vid);
   }
   template <typename T>
-  void allocAndInitData(T*& ptr, int len,
+  void allocAndInitData(T*& ptr, Index_type len,
                         VariantID vid)
   {
     rajaperf::detail::allocAndInitData(ptr, len, getDataAlignment(), vid);
   }
   template <typename T>
-  void allocAndInitDataConst(T*& ptr, int len, T val,
+  void allocAndInitDataConst(T*& ptr, Index_type len, T val,
                              VariantID vid)
   {
     rajaperf::detail::allocAndInitDataConst(ptr, len, getDataAlignment(), val, vid);
   }
   template <typename T>
-  void allocAndInitDataRandSign(T*& ptr, int len,
+  void allocAndInitDataRandSign(T*& ptr, Index_type len,
                                 VariantID vid)
   {
     rajaperf::detail::allocAndInitDataRandSign(ptr, len, getDataAlignment(), vid);
   }
   template <typename T>
-  void allocAndInitDataRandValue(T*& ptr, int len,
+  void allocAndInitDataRandValue(T*& ptr, Index_type len,
                                  VariantID vid)
   {
     rajaperf::detail::allocAndInitDataRandValue(ptr, len, getDataAlignment(), vid);
@@ -226,25 +296,25 @@ public:
     rajaperf::detail::deallocData(ptr, vid);
   }
   template <typename T>
-  void initData(T*& ptr, int len,
+  void initData(T*& ptr, Index_type len,
                 VariantID vid)
   {
     rajaperf::detail::initData(ptr, len, vid);
   }
   template <typename T>
-  void initDataConst(T*& ptr, int len, T val,
+  void initDataConst(T*& ptr, Index_type len, T val,
                      VariantID vid)
   {
     rajaperf::detail::initDataConst(ptr, len, val, vid);
   }
   template <typename T>
-  void initDataRandSign(T*& ptr, int len,
+  void initDataRandSign(T*& ptr, Index_type len,
                         VariantID vid)
   {
     rajaperf::detail::initDataRandSign(ptr, len, vid);
   }
   template <typename T>
-  void initDataRandValue(T*& ptr, int len,
+  void initDataRandValue(T*& ptr, Index_type len,
                          VariantID vid)
   {
     rajaperf::detail::initDataRandValue(ptr, len, vid);
@@ -262,6 +332,7 @@ public:
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
+    if ( count_perf_events ) { detail::startPerfCounters(); }
     timer.start();
   }
 
@@ -271,7 +342,12 @@ public:
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-    timer.stop(); recordExecTime();
+    timer.stop();
+    if ( count_perf_events &&
+         !detail::stopPerfCounters(running_perf_counts) ) {
+      running_perf_scheduled = false;
+    }
+    recordSampleTime();
   }
 
   void resetTimer() { timer.reset(); }
@@ -289,7 +365,19 @@ public:
   virtual void updateChecksum(VariantID vid, size_t tune_idx) = 0;
   virtual void tearDown(VariantID vid, size_t tune_idx) = 0;
 
+  // restore initial values of data for all reps; called outside the timed
+  // region when reps wrap around to data already used, so kernels that
+  // modify their data in place must override it
+  virtual void resetData(VariantID RAJAPERF_UNUSED_ARG(vid),
+                         size_t RAJAPERF_UNUSED_ARG(tune_idx)) { }
+
   virtual void runSeqVariant(VariantID vid, size_t tune_idx) = 0;
+#if defined(RUN_SIMD)
+  virtual void runSIMDVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented SIMD variant id = " << vid << std::endl;
+  }
+#endif
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   virtual void runOpenMPVariant(VariantID vid, size_t tune_idx) = 0;
 #endif
@@ -318,8 +406,15 @@ protected:
 private:
   KernelBase() = delete;
 
+  void runSample(VariantID vid, size_t tune_idx,
+                 Index_type run_reps, Index_type sample_reps);
+  bool isTimingConverged() const;
+
+  void recordSampleTime();
   void recordExecTime();
 
+  void setOpenMPSchedule(VariantID vid, size_t tune_idx) const;
+
   //
   // Static properties of kernel, independent of run
   //
@@ -348,11 +443,48 @@ private:
 
   std::vector<int> num_exec[NumVariants];
 
-  RAJA::Timer timer;
+  // index of first OpenMP schedule tuning of each variant, if it has them
+  size_t omp_schedule_tune_idx_begin[NumVariants];
+
+  Index_type running_reps;
+  Index_type running_rep_offset;
+  Index_type running_num_reps;
+  int running_num_samples;
+  long running_minor_faults;
+  long running_major_faults;
+
+  detail::DataFootprint data_footprint;
+  size_t peak_rss_bytes;
+
+  // with adaptive reps, nominal reps are split into this many samples
+  // and at least this many samples are run before checking convergence
+  static constexpr Index_type adaptive_samples_per_run = 20;
+  static constexpr Index_type adaptive_min_samples = 5;
+
+  PerfTimer timer;
+
+  RAJA::Timer::ElapsedType running_time;
+  RAJA::Timer::ElapsedType last_time;
+  std::vector<double> running_sample_times;
+
+  bool count_perf_events;
+  bool running_perf_scheduled;
+  long double running_perf_counts[NumPerfCounters];
+
+  std::vector<int> omp_thread_cpus;
+  std::vector<int> omp_thread_numa_nodes;
+
+  std::function<void()> start_hook;
 
   std::vector<RAJA::Timer::ElapsedType> min_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> max_time[NumVariants];
   std::vector<RAJA::Timer::ElapsedType> tot_time[NumVariants];
+  std::vector<std::vector<double>> sample_times[NumVariants];
+  std::vector<Index_type> tot_reps[NumVariants];
+  std::vector<long> tot_minor_faults[NumVariants];
+  std::vector<long> tot_major_faults[NumVariants];
+  std::vector<std::array<long double, NumPerfCounters>> tot_perf_counts[NumVariants];
+  std::vector<bool> perf_counts_scheduled[NumVariants];
 };
 
 }  // closing brace for rajaperf namespace
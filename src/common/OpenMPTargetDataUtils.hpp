@@ -30,7 +30,7 @@ namespace rajaperf
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void copyOpenMPDeviceData(T& dptr, const T hptr, int len,
+void copyOpenMPDeviceData(T& dptr, const T hptr, Index_type len,
                           int did, int hid)
 {
   omp_target_memcpy( dptr, hptr,
@@ -45,7 +45,7 @@ void copyOpenMPDeviceData(T& dptr, const T hptr, int len,
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void initOpenMPDeviceData(T& dptr, const T hptr, int len,
+void initOpenMPDeviceData(T& dptr, const T hptr, Index_type len,
                           int did, int hid)
 {
   copyOpenMPDeviceData(dptr, hptr, len, did, hid);
@@ -57,11 +57,14 @@ void initOpenMPDeviceData(T& dptr, const T hptr, int len,
  * data to device array.
  */
 template <typename T>
-void allocOpenMPDeviceData(T& dptr, int len, int did)
+void allocOpenMPDeviceData(T& dptr, Index_type len, int did)
 {
   dptr = static_cast<T>( omp_target_alloc(
                          len * sizeof(typename std::remove_pointer<T>::type),
                          did) );
+  detail::recordDataAlloc(dptr,
+                          len * sizeof(typename std::remove_pointer<T>::type),
+                          detail::DataSpace::Device);
 }
 
 /*!
@@ -69,7 +72,7 @@ void allocOpenMPDeviceData(T& dptr, int len, int did)
  * data to device array.
  */
 template <typename T>
-void allocAndInitOpenMPDeviceData(T& dptr, const T hptr, int len,
+void allocAndInitOpenMPDeviceData(T& dptr, const T hptr, Index_type len,
                                   int did, int hid)
 {
   allocOpenMPDeviceData(dptr, len, did);
@@ -83,7 +86,7 @@ void allocAndInitOpenMPDeviceData(T& dptr, const T hptr, int len,
  * and of propoer size for copy operation to succeed.
  */
 template <typename T>
-void getOpenMPDeviceData(T& hptr, const T dptr, int len, int hid, int did)
+void getOpenMPDeviceData(T& hptr, const T dptr, Index_type len, int hid, int did)
 {
   omp_target_memcpy( hptr, dptr,
                      len * sizeof(typename std::remove_pointer<T>::type),
@@ -96,6 +99,7 @@ void getOpenMPDeviceData(T& hptr, const T dptr, int len, int hid, int did)
 template <typename T>
 void deallocOpenMPDeviceData(T& dptr, int did)
 {
+  detail::recordDataDealloc(dptr);
   omp_target_free( dptr, did );
   dptr = 0;
 }
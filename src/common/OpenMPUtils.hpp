@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// RAJA policy, macros, and method for OpenMP loop schedule tunings.
+///
+
+#ifndef RAJAPerf_OpenMPUtils_HPP
+#define RAJAPerf_OpenMPUtils_HPP
+
+#include "RunParams.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include "RAJA/RAJA.hpp"
+
+#include <omp.h>
+#endif
+
+#include <type_traits>
+
+namespace rajaperf
+{
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+//
+// RAJA policy for OpenMP parallel loops with schedule(runtime); kernels
+// write their OpenMP variants once, templated on the loop policy, and run
+// them with this policy in OpenMP schedule tunings and with
+// RAJA::omp_parallel_for_exec in default tunings.
+//
+using omp_parallel_for_runtime_exec =
+  RAJA::omp_parallel_exec<RAJA::omp_for_runtime_exec>;
+
+//
+// True if OpenMP loop policy EXEC_POL runs with schedule(runtime).
+//
+template < typename EXEC_POL >
+struct is_omp_runtime_schedule
+  : std::is_same<EXEC_POL, omp_parallel_for_runtime_exec>
+{ };
+
+#define RAJAPERF_PRAGMA(x) _Pragma(#x)
+
+//
+// Run the loop given as the last macro argument with
+// "omp parallel for schedule(runtime) CLAUSES" if EXEC_POL is
+// omp_parallel_for_runtime_exec, else with "omp parallel for CLAUSES", so
+// base and lambda variants use the schedule of the tuning as their RAJA
+// variants do. Pragmas in the loop must be written as _Pragma("...").
+//
+#define RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(EXEC_POL, CLAUSES, ...) \
+  if ( ::rajaperf::is_omp_runtime_schedule<EXEC_POL>::value ) { \
+    RAJAPERF_PRAGMA(omp parallel for schedule(runtime) CLAUSES) \
+    __VA_ARGS__ \
+  } else { \
+    RAJAPERF_PRAGMA(omp parallel for CLAUSES) \
+    __VA_ARGS__ \
+  }
+
+#define RAJAPERF_OMP_PARALLEL_FOR(EXEC_POL, ...) \
+  RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(EXEC_POL, , __VA_ARGS__)
+#endif
+
+namespace detail
+{
+
+/*!
+ * \brief Set schedule used by OpenMP loops with schedule(runtime) in
+ *        parallel regions started by calling thread.
+ */
+inline void setOpenMPSchedule(const RunParams::OpenMPSchedule& sched)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  omp_sched_t kind = omp_sched_static;
+  switch ( sched.kind ) {
+    case RunParams::OpenMPScheduleKind::StaticSchedule:
+      kind = omp_sched_static;
+      break;
+    case RunParams::OpenMPScheduleKind::DynamicSchedule:
+      kind = omp_sched_dynamic;
+      break;
+    case RunParams::OpenMPScheduleKind::GuidedSchedule:
+      kind = omp_sched_guided;
+      break;
+  }
+  // chunk size < 1 is the default chunk size of the kind
+  omp_set_schedule(kind, sched.chunk);
+#else
+  (void) sched;
+#endif
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -13,6 +13,7 @@
 #include <mpi.h>
 #endif
 
+#include<cmath>
 #include<cstdlib>
 #include<iostream>
 #include<iomanip>
@@ -149,4 +150,45 @@ std::string recursiveMkdir(const std::string& in_path)
   return outpath;
 }
 
+/*
+ * Quote and escape string for JSON output.
+ */
+std::string getJSONString(const std::string& str)
+{
+  std::ostringstream json;
+  json << '"';
+  for (char c : str) {
+    switch ( c ) {
+      case '"'  : json << "\\\""; break;
+      case '\\' : json << "\\\\"; break;
+      case '\n' : json << "\\n"; break;
+      case '\r' : json << "\\r"; break;
+      case '\t' : json << "\\t"; break;
+      default : {
+        if ( static_cast<unsigned char>(c) < 0x20 ) {
+          json << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+               << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          json << c;
+        }
+      }
+    }
+  }
+  json << '"';
+  return json.str();
+}
+
+/*
+ * Format number for JSON output; JSON has no inf or nan.
+ */
+std::string getJSONNumber(long double val, int prec)
+{
+  if ( !std::isfinite(val) ) {
+    return std::string("null");
+  }
+  std::ostringstream json;
+  json << std::setprecision(prec) << val;
+  return json.str();
+}
+
 }  // closing brace for rajaperf namespace
@@ -26,6 +26,17 @@ namespace rajaperf
  */
 std::string recursiveMkdir(const std::string& in_path);
 
+/*!
+ * \brief Return given string as quoted JSON string with special
+ * characters escaped.
+ */
+std::string getJSONString(const std::string& str);
+
+/*!
+ * \brief Return given number as JSON number, or null if it is not finite.
+ */
+std::string getJSONNumber(long double val, int prec = 17);
+
 }  // closing brace for rajaperf namespace
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,304 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PerfCounters.hpp"
+
+#include "RAJAPerfSuite.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each COUNTER in suite.
+ *
+ * IMPORTANT: This is only modified when a counter is added or removed.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF COUNTER NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string PerfCounterNames [] =
+{
+
+  std::string("cycles"),
+  std::string("instructions"),
+  std::string("LLC-misses"),
+  std::string("dTLB-misses"),
+  std::string("branch-misses"),
+
+  std::string("Unknown Counter")  // Keep this at the end and DO NOT remove....
+
+}; // END PerfCounterNames
+
+
+/*
+ *******************************************************************************
+ *
+ * Return counter name associated with PerfCounterID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPerfCounterName(PerfCounterID pcid)
+{
+  return PerfCounterNames[pcid];
+}
+
+
+namespace detail
+{
+
+#if defined(__linux__)
+
+//
+// Counters are opened as one group so they count over the same intervals
+// and ratios of counts (e.g., IPC) are exact when the kernel multiplexes
+// counters. The first counter opened, cycles when it is collected, leads
+// the group; the group is enabled, disabled, and read through its leader.
+//
+static std::vector<int> perf_counter_fd(NumPerfCounters, -1);
+static int perf_group_fd = -1;
+// counters in order of their values in a group read
+static std::vector<PerfCounterID> perf_group_ids;
+static bool perf_counting = true;
+
+//
+// Values read from counter group: time enabled, time running, and count
+// of each counter in group.
+//
+struct PerfCounterValue
+{
+  uint64_t time_enabled;
+  uint64_t time_running;
+  uint64_t count[NumPerfCounters];
+};
+
+static PerfCounterValue perf_counter_start;
+
+static void setPerfEventAttr(PerfCounterID pcid, perf_event_attr& attr)
+{
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+
+  switch ( pcid ) {
+    case Cycles : {
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    }
+    case Instructions : {
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    }
+    case LLC_Misses : {
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_LL |
+                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      break;
+    }
+    case DTLB_Misses : {
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      break;
+    }
+    case Branch_Misses : {
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    }
+    default : { }
+  }
+
+  attr.read_format = PERF_FORMAT_GROUP |
+                     PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // group members count whenever the leader does
+  attr.disabled = ( perf_group_fd < 0 ) ? 1 : 0;
+  // count in OpenMP threads created after counters are opened
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+}
+
+static bool readPerfCounters(PerfCounterValue& val)
+{
+  // layout of group read: number of counters, time enabled, time running,
+  // then one count per counter
+  uint64_t buf[3 + NumPerfCounters];
+  const size_t nbytes = (3 + perf_group_ids.size()) * sizeof(uint64_t);
+  if ( perf_group_fd < 0 ||
+       read(perf_group_fd, buf, nbytes) != static_cast<ssize_t>(nbytes) ||
+       buf[0] != perf_group_ids.size() ) {
+    return false;
+  }
+  val.time_enabled = buf[1];
+  val.time_running = buf[2];
+  for (size_t ig = 0; ig < perf_group_ids.size(); ++ig) {
+    val.count[ig] = buf[3 + ig];
+  }
+  return true;
+}
+
+bool openPerfCounters(const std::vector<PerfCounterID>& pcids)
+{
+  closePerfCounters();
+
+  bool any_open = false;
+  for (int ipc = 0; ipc < NumPerfCounters; ++ipc) {
+    PerfCounterID pcid = static_cast<PerfCounterID>(ipc);
+    if ( std::find(pcids.begin(), pcids.end(), pcid) == pcids.end() ) {
+      continue;
+    }
+
+    perf_event_attr attr;
+    setPerfEventAttr(pcid, attr);
+
+    int fd = static_cast<int>( syscall(__NR_perf_event_open, &attr,
+                                       0 /* this process */,
+                                       -1 /* any cpu */,
+                                       perf_group_fd, 0) );
+    if ( fd < 0 ) {
+      getCout() << "\n Can't open perf counter " << getPerfCounterName(pcid)
+                << ": " << strerror(errno) << std::endl;
+    } else {
+      perf_counter_fd[pcid] = fd;
+      if ( perf_group_fd < 0 ) {
+        perf_group_fd = fd;
+      }
+      perf_group_ids.emplace_back(pcid);
+      any_open = true;
+    }
+  }
+
+  return any_open;
+}
+
+void closePerfCounters()
+{
+  // close members before leader
+  for (int pcid = NumPerfCounters-1; pcid >= 0; --pcid) {
+    if ( perf_counter_fd[pcid] >= 0 ) {
+      close(perf_counter_fd[pcid]);
+      perf_counter_fd[pcid] = -1;
+    }
+  }
+  perf_group_fd = -1;
+  perf_group_ids.clear();
+}
+
+bool perfCountersOpen()
+{
+  return perf_group_fd >= 0;
+}
+
+bool perfCounterOpen(PerfCounterID pcid)
+{
+  return perf_counter_fd[pcid] >= 0;
+}
+
+void setPerfCounting(bool enable)
+{
+  perf_counting = enable;
+}
+
+bool perfCountingEnabled()
+{
+  return perf_group_fd >= 0 && perf_counting;
+}
+
+void startPerfCounters()
+{
+  if ( perf_group_fd >= 0 ) {
+    if ( !readPerfCounters(perf_counter_start) ) {
+      perf_counter_start = PerfCounterValue();
+    }
+    ioctl(perf_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+bool stopPerfCounters(long double counts[NumPerfCounters])
+{
+  if ( perf_group_fd < 0 ) {
+    return true;
+  }
+
+  ioctl(perf_group_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+  PerfCounterValue val;
+  if ( !readPerfCounters(val) ) {
+    return false;
+  }
+
+  const PerfCounterValue& start = perf_counter_start;
+  uint64_t enabled = val.time_enabled - start.time_enabled;
+  uint64_t running = val.time_running - start.time_running;
+  if ( enabled > 0 && running == 0 ) {
+    // group was never scheduled, so there are no counts to scale
+    return false;
+  }
+
+  // all counters in group are scaled by the same factor
+  long double scale = 1.0;
+  if ( running > 0 && running < enabled ) {
+    scale = static_cast<long double>(enabled) / running;
+  }
+  for (size_t ig = 0; ig < perf_group_ids.size(); ++ig) {
+    long double count = val.count[ig] - start.count[ig];
+    counts[perf_group_ids[ig]] += count * scale;
+  }
+
+  return true;
+}
+
+#else
+
+bool openPerfCounters(const std::vector<PerfCounterID>&)
+{
+  getCout() << "\n Perf counters are only supported on Linux" << std::endl;
+  return false;
+}
+
+void closePerfCounters() { }
+
+bool perfCountersOpen() { return false; }
+
+bool perfCounterOpen(PerfCounterID) { return false; }
+
+void setPerfCounting(bool) { }
+
+bool perfCountingEnabled() { return false; }
+
+void startPerfCounters() { }
+
+bool stopPerfCounters(long double*) { return true; }
+
+#endif
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
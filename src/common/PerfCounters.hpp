@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for collecting hardware performance counters while kernels are
+/// timed. Counters are collected with the Linux perf_event_open interface
+/// and are not available on other platforms.
+///
+
+#ifndef RAJAPerf_PerfCounters_HPP
+#define RAJAPerf_PerfCounters_HPP
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each hardware counter.
+ *
+ * IMPORTANT: This is only modified when a counter is added or removed.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF COUNTER NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum PerfCounterID {
+
+  Cycles = 0,
+  Instructions,
+  LLC_Misses,
+  DTLB_Misses,
+  Branch_Misses,
+
+  NumPerfCounters // Keep this one last and NEVER comment out (!!)
+
+};
+
+/*!
+ * \brief Return counter name associated with PerfCounterID enum value.
+ */
+const std::string& getPerfCounterName(PerfCounterID pcid);
+
+namespace detail
+{
+
+/*!
+ * \brief Open given counters for calling process and threads it creates
+ *        afterward, as one group so they count over the same intervals;
+ *        counters that can't be opened are reported and skipped.
+ *
+ * Returns true if at least one counter was opened.
+ */
+bool openPerfCounters(const std::vector<PerfCounterID>& pcids);
+
+/*!
+ * \brief Close all open counters.
+ */
+void closePerfCounters();
+
+/*!
+ * \brief Return true if any counter is open.
+ */
+bool perfCountersOpen();
+
+/*!
+ * \brief Return true if given counter is open.
+ */
+bool perfCounterOpen(PerfCounterID pcid);
+
+/*!
+ * \brief Enable or disable counting events in kernels run afterward with
+ *        open counters; counting is enabled by default.
+ */
+void setPerfCounting(bool enable);
+
+/*!
+ * \brief Return true if any counter is open and counting is enabled.
+ */
+bool perfCountingEnabled();
+
+/*!
+ * \brief Start counting events with all open counters.
+ */
+void startPerfCounters();
+
+/*!
+ * \brief Stop counting events and add counts since last call to
+ *        startPerfCounters to given array, indexed by PerfCounterID.
+ *
+ * Counts are scaled when the kernel multiplexed counters. Returns false,
+ * adding no counts, if the counter group was never scheduled while it was
+ * enabled (e.g., other events held all hardware counters).
+ */
+bool stopPerfCounters(long double counts[NumPerfCounters]);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
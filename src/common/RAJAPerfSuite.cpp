@@ -65,6 +65,7 @@
 #include "polybench/POLYBENCH_JACOBI_1D.hpp"
 #include "polybench/POLYBENCH_JACOBI_2D.hpp"
 #include "polybench/POLYBENCH_MVT.hpp"
+#include "polybench/POLYBENCH_SYRK.hpp"
 
 //
 // Stream kernels...
@@ -74,6 +75,7 @@
 #include "stream/ADD.hpp"
 #include "stream/TRIAD.hpp"
 #include "stream/DOT.hpp"
+#include "stream/FUSED.hpp"
 
 //
 // Apps kernels...
@@ -103,6 +105,15 @@
 #include "algorithm/MEMSET.hpp"
 #include "algorithm/MEMCPY.hpp"
 
+//
+// Overhead kernels...
+//
+#include "overhead/FORALL.hpp"
+#include "overhead/PARALLEL_REGION.hpp"
+#include "overhead/BARRIER.hpp"
+#include "overhead/REDUCE.hpp"
+#include "overhead/ATOMIC.hpp"
+
 
 #include <iostream>
 
@@ -129,6 +140,7 @@ static const std::string GroupNames [] =
   std::string("Stream"),
   std::string("Apps"),
   std::string("Algorithm"),
+  std::string("Overhead"),
 
   std::string("Unknown Group")  // Keep this at the end and DO NOT remove....
 
@@ -201,6 +213,7 @@ static const std::string KernelNames [] =
   std::string("Polybench_JACOBI_1D"),
   std::string("Polybench_JACOBI_2D"),
   std::string("Polybench_MVT"),
+  std::string("Polybench_SYRK"),
 
 //
 // Stream kernels...
@@ -208,6 +221,7 @@ static const std::string KernelNames [] =
   std::string("Stream_ADD"),
   std::string("Stream_COPY"),
   std::string("Stream_DOT"),
+  std::string("Stream_FUSED"),
   std::string("Stream_MUL"),
   std::string("Stream_TRIAD"),
 
@@ -239,6 +253,15 @@ static const std::string KernelNames [] =
   std::string("Algorithm_MEMSET"),
   std::string("Algorithm_MEMCPY"),
 
+//
+// Overhead kernels...
+//
+  std::string("Overhead_FORALL"),
+  std::string("Overhead_PARALLEL_REGION"),
+  std::string("Overhead_BARRIER"),
+  std::string("Overhead_REDUCE"),
+  std::string("Overhead_ATOMIC"),
+
   std::string("Unknown Kernel")  // Keep this at the end and DO NOT remove....
 
 }; // END KernelNames
@@ -263,6 +286,8 @@ static const std::string VariantNames [] =
   std::string("Lambda_Seq"),
   std::string("RAJA_Seq"),
 
+  std::string("Base_SIMD"),
+
   std::string("Base_OpenMP"),
   std::string("Lambda_OpenMP"),
   std::string("RAJA_OpenMP"),
@@ -393,6 +418,12 @@ bool isVariantAvailable(VariantID vid)
   }
 #endif
 
+#if defined(RUN_SIMD)
+  if ( vid == Base_SIMD ) {
+    ret_val = true;
+  }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   if ( vid == Base_OpenMP ||
        vid == Lambda_OpenMP ||
@@ -454,6 +485,12 @@ bool isVariantGPU(VariantID vid)
   }
 #endif
 
+#if defined(RUN_SIMD)
+  if ( vid == Base_SIMD ) {
+    ret_val = false;
+  }
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
   if ( vid == Base_OpenMP ||
        vid == Lambda_OpenMP ||
@@ -691,6 +728,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_MVT(run_params);
        break;
     }
+    case Polybench_SYRK : {
+       kernel = new polybench::POLYBENCH_SYRK(run_params);
+       break;
+    }
 
 //
 // Stream kernels...
@@ -707,6 +748,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new stream::DOT(run_params);
        break;
     }
+    case Stream_FUSED : {
+       kernel = new stream::FUSED(run_params);
+       break;
+    }
     case Stream_MUL : {
        kernel = new stream::MUL(run_params);
        break;
@@ -804,6 +849,30 @@ KernelBase* getKernelObject(KernelID kid,
        break;
     }
 
+//
+// Overhead kernels...
+//
+    case Overhead_FORALL: {
+       kernel = new overhead::FORALL(run_params);
+       break;
+    }
+    case Overhead_PARALLEL_REGION: {
+       kernel = new overhead::PARALLEL_REGION(run_params);
+       break;
+    }
+    case Overhead_BARRIER: {
+       kernel = new overhead::BARRIER(run_params);
+       break;
+    }
+    case Overhead_REDUCE: {
+       kernel = new overhead::REDUCE(run_params);
+       break;
+    }
+    case Overhead_ATOMIC: {
+       kernel = new overhead::ATOMIC(run_params);
+       break;
+    }
+
     default: {
       getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
     }
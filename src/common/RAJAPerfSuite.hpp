@@ -46,6 +46,7 @@ enum GroupID {
   Stream,
   Apps,
   Algorithm,
+  Overhead,
 
   NumGroups // Keep this one last and DO NOT remove (!!)
 
@@ -118,6 +119,7 @@ enum KernelID {
   Polybench_JACOBI_1D,
   Polybench_JACOBI_2D,
   Polybench_MVT,
+  Polybench_SYRK,
 
 //
 // Stream kernels...
@@ -125,6 +127,7 @@ enum KernelID {
   Stream_ADD,
   Stream_COPY,
   Stream_DOT,
+  Stream_FUSED,
   Stream_MUL,
   Stream_TRIAD,
 
@@ -156,6 +159,15 @@ enum KernelID {
   Algorithm_MEMSET,
   Algorithm_MEMCPY,
 
+//
+// Overhead kernels...
+//
+  Overhead_FORALL,
+  Overhead_PARALLEL_REGION,
+  Overhead_BARRIER,
+  Overhead_REDUCE,
+  Overhead_ATOMIC,
+
   NumKernels // Keep this one last and NEVER comment out (!!)
 
 };
@@ -179,6 +191,8 @@ enum VariantID {
   Lambda_Seq,
   RAJA_Seq,
 
+  Base_SIMD,
+
   Base_OpenMP,
   Lambda_OpenMP,
   RAJA_OpenMP,
@@ -0,0 +1,187 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "Roofline.hpp"
+
+#include "CacheUtils.hpp"
+#include "RAJAPerfSuite.hpp"
+#include "RPTypes.hpp"
+
+#include "RAJA/util/Timer.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace rajaperf
+{
+
+size_t RooflinePeaks::getLevel(double footprint) const
+{
+  return detail::getCacheLevel(level_capacity, footprint);
+}
+
+namespace detail
+{
+
+//
+// Minimum time (sec.) of each calibration trial and number of trials;
+// the best trial is used.
+//
+static const double calib_min_time = 0.05;
+static const int calib_num_trials = 5;
+
+//
+// Number of independent FMA chains; enough to cover FMA latency for
+// the widest vector units.
+//
+static const int calib_num_fma_chains = 64;
+
+/*
+ * Run triad over arrays of given length, repeated until the minimum trial
+ * time is reached, and return best bandwidth (bytes/sec.) over trials.
+ */
+static double measureBandwidth(Index_type len, int num_threads)
+{
+  Real_ptr a = new Real_type[len];
+  Real_ptr b = new Real_type[len];
+  Real_ptr c = new Real_type[len];
+
+  // first touch with same threads that run triad
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  #pragma omp parallel for schedule(static) num_threads(num_threads)
+#else
+  (void)num_threads;
+#endif
+  for (Index_type i = 0; i < len; ++i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  }
+
+  const Real_type q = 1.0e-8;
+  double best_bandwidth = 0.0;
+
+  for (int trial = 0; trial < calib_num_trials; ++trial) {
+
+    Index_type reps = 1;
+    double elapsed = 0.0;
+    do {
+      RAJA::Timer timer;
+      timer.start();
+      for (Index_type irep = 0; irep < reps; ++irep) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+        #pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+        for (Index_type i = 0; i < len; ++i) {
+          a[i] = b[i] + q * c[i];
+        }
+        std::swap(a, b);
+      }
+      timer.stop();
+      elapsed = timer.elapsed();
+      if ( elapsed < calib_min_time ) {
+        reps *= 2;
+      }
+    } while ( elapsed < calib_min_time );
+
+    double bytes = 3.0 * sizeof(Real_type) * len * reps;
+    best_bandwidth = std::max(best_bandwidth, bytes / elapsed);
+  }
+
+  delete [] a;
+  delete [] b;
+  delete [] c;
+
+  return best_bandwidth;
+}
+
+/*
+ * Run independent FMA chains in each thread, repeated until the minimum
+ * trial time is reached, and return best FLOP rate (FLOP/sec.) over trials.
+ */
+static double measureFlops(int num_threads)
+{
+  // volatile so compiler can't evaluate FMA chains at compile time
+  volatile Real_type mult_in = 0.999999999;
+  volatile Real_type add_in = 1.0e-9;
+  const Real_type mult = mult_in;
+  const Real_type add = add_in;
+
+  double best_flops = 0.0;
+  volatile Real_type sink = 0.0;
+
+  for (int trial = 0; trial < calib_num_trials; ++trial) {
+
+    Index_type reps = 1024;
+    double elapsed = 0.0;
+    do {
+      Real_type sum = 0.0;
+      RAJA::Timer timer;
+      timer.start();
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+      #pragma omp parallel num_threads(num_threads) reduction(+:sum)
+#endif
+      {
+        Real_type acc[calib_num_fma_chains];
+        for (int j = 0; j < calib_num_fma_chains; ++j) {
+          acc[j] = 1.0 + j * add;
+        }
+        for (Index_type irep = 0; irep < reps; ++irep) {
+          for (int j = 0; j < calib_num_fma_chains; ++j) {
+            acc[j] = acc[j] * mult + add;
+          }
+        }
+        for (int j = 0; j < calib_num_fma_chains; ++j) {
+          sum += acc[j];
+        }
+      }
+      timer.stop();
+      sink = sink + sum;
+      elapsed = timer.elapsed();
+      if ( elapsed < calib_min_time ) {
+        reps *= 2;
+      }
+    } while ( elapsed < calib_min_time );
+
+    double flops = 2.0 * calib_num_fma_chains * reps * num_threads;
+    best_flops = std::max(best_flops, flops / elapsed);
+  }
+
+  return best_flops;
+}
+
+void calibrateRoofline(RooflinePeaks& peaks, int num_threads)
+{
+  peaks = RooflinePeaks();
+  peaks.num_threads = num_threads;
+
+  getCacheLevels(num_threads, peaks.level_names, peaks.level_capacity);
+
+  //
+  // Measure each cache level with footprint half its capacity, and DRAM
+  // with footprint well beyond last level cache.
+  //
+  for (size_t il = 0; il < peaks.level_capacity.size(); ++il) {
+    double footprint = ( il+1 < peaks.level_capacity.size() ) ?
+                       0.5 * peaks.level_capacity[il] :
+                       std::max(2.0 * peaks.level_capacity[il-1],
+                                256.0*1024*1024);
+    Index_type len = std::max(static_cast<Index_type>(
+                                footprint / (3 * sizeof(Real_type))),
+                              static_cast<Index_type>(num_threads));
+    peaks.level_bandwidth.push_back( measureBandwidth(len, num_threads) );
+  }
+
+  peaks.flops = measureFlops(num_threads);
+
+  peaks.calibrated = true;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
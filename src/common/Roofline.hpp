@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for measuring machine peaks used in roofline reports.
+///
+
+#ifndef RAJAPerf_Roofline_HPP
+#define RAJAPerf_Roofline_HPP
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Measured host peaks for one programming model (sequential or
+ *        OpenMP).
+ *
+ * Memory levels are ordered from fastest (L1) to slowest (DRAM). Level
+ * capacity is the largest data footprint (bytes) that runs at the level
+ * bandwidth; the last level (DRAM) has unbounded capacity.
+ *
+ *******************************************************************************
+ */
+struct RooflinePeaks
+{
+  bool calibrated = false;
+  int num_threads = 1;
+
+  std::vector<std::string> level_names;
+  std::vector<double> level_capacity;   // bytes
+  std::vector<double> level_bandwidth;  // bytes/sec.
+
+  double flops = 0.0;                   // FLOP/sec.
+
+  //
+  // Return index of fastest memory level that holds given footprint.
+  //
+  size_t getLevel(double footprint) const;
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Measure sustained bandwidth of each cache level and DRAM, and
+ *        peak FMA throughput, of the host running the given number of
+ *        threads (>1 requires OpenMP).
+ */
+void calibrateRoofline(RooflinePeaks& peaks, int num_threads);
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -8,11 +8,14 @@
 
 #include "RunParams.hpp"
 
+#include "AffinityUtils.hpp"
 #include "KernelBase.hpp"
+#include "OutputUtils.hpp"
 
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
+#include <sstream>
 
 namespace rajaperf
 {
@@ -31,14 +34,37 @@ RunParams::RunParams(int argc, char** argv)
    npasses(1),
    npasses_combiners(),
    rep_fact(1.0),
+   sample_reps(0),
+   histogram_bins(20),
+   adaptive_reps(false),
+   ci_target(1.0),
+   ci_max_time(10.0),
+   perf_counters(false),
+   perf_counter_ids(),
+   roofline(false),
    size_meaning(SizeMeaning::Unset),
    size(0.0),
    size_factor(0.0),
+   size_sweep(),
    data_alignment(RAJA::DATA_ALIGN),
+   data_init_mode(DataInitMode::ParallelInit),
+   host_memory_mode(HostMemoryMode::AlignedMemory),
+   data_cache(false),
+   cache_mode(CacheMode::WarmCache),
+   timer_backend(TimerBackend::RAJATimer),
+   thread_sweep(),
+   weak_scaling(false),
+   corun_instances(0),
+   corun_kernel_input(),
+   thread_binding(ThreadBinding::NoBinding),
+   thread_bind_cpus(),
+   omp_schedules(),
    gpu_block_sizes(),
    pf_tol(0.1),
    checkrun_reps(1),
    reference_variant(),
+   compare_files(),
+   compare_threshold(5.0),
    kernel_input(),
    invalid_kernel_input(),
    exclude_kernel_input(),
@@ -53,6 +79,8 @@ RunParams::RunParams(int argc, char** argv)
    invalid_exclude_feature_input(),
    npasses_combiner_input(),
    invalid_npasses_combiner_input(),
+   perf_counter_input(),
+   invalid_perf_counter_input(),
    outdir(),
    outfile_prefix("RAJAPerf")
 {
@@ -96,10 +124,57 @@ void RunParams::print(std::ostream& str) const
     str << "\n\t" << invalid_npasses_combiner_input[j];
   }
   str << "\n rep_fact = " << rep_fact;
+  str << "\n sample_reps = " << sample_reps;
+  str << "\n histogram_bins = " << histogram_bins;
+  str << "\n adaptive_reps = " << adaptive_reps;
+  str << "\n ci_target = " << ci_target;
+  str << "\n ci_max_time = " << ci_max_time;
+  str << "\n perf_counters = " << perf_counters;
+  str << "\n roofline = " << roofline;
+  str << "\n perf_counter_ids = ";
+  for (size_t j = 0; j < perf_counter_ids.size(); ++j) {
+    str << "\n\t" << getPerfCounterName(perf_counter_ids[j]);
+  }
+  str << "\n perf_counter_input = ";
+  for (size_t j = 0; j < perf_counter_input.size(); ++j) {
+    str << "\n\t" << perf_counter_input[j];
+  }
+  str << "\n invalid_perf_counter_input = ";
+  for (size_t j = 0; j < invalid_perf_counter_input.size(); ++j) {
+    str << "\n\t" << invalid_perf_counter_input[j];
+  }
   str << "\n size_meaning = " << SizeMeaningToStr(getSizeMeaning());
   str << "\n size = " << size;
   str << "\n size_factor = " << size_factor;
+  str << "\n size_sweep = ";
+  for (size_t j = 0; j < size_sweep.size(); ++j) {
+    str << "\n\t" << size_sweep[j];
+  }
   str << "\n data_alignment = " << data_alignment;
+  str << "\n data_init_mode = " << DataInitModeToStr(data_init_mode);
+  str << "\n host_memory_mode = " << HostMemoryModeToStr(host_memory_mode);
+  str << "\n data_cache = " << data_cache;
+  str << "\n cache_mode = " << CacheModeToStr(cache_mode);
+  str << "\n timer_backend = " << TimerBackendToStr(timer_backend);
+  str << "\n thread_sweep = ";
+  for (size_t j = 0; j < thread_sweep.size(); ++j) {
+    str << "\n\t" << thread_sweep[j];
+  }
+  str << "\n weak_scaling = " << weak_scaling;
+  str << "\n corun_instances = " << corun_instances;
+  str << "\n corun_kernel_input = ";
+  for (size_t j = 0; j < corun_kernel_input.size(); ++j) {
+    str << "\n\t" << corun_kernel_input[j];
+  }
+  str << "\n thread_binding = " << ThreadBindingToStr(thread_binding);
+  str << "\n thread_bind_cpus = ";
+  for (size_t j = 0; j < thread_bind_cpus.size(); ++j) {
+    str << "\n\t" << thread_bind_cpus[j];
+  }
+  str << "\n omp_schedules = ";
+  for (size_t j = 0; j < omp_schedules.size(); ++j) {
+    str << "\n\t" << OpenMPScheduleToStr(omp_schedules[j]);
+  }
   str << "\n gpu_block_sizes = ";
   for (size_t j = 0; j < gpu_block_sizes.size(); ++j) {
     str << "\n\t" << gpu_block_sizes[j];
@@ -107,6 +182,11 @@ void RunParams::print(std::ostream& str) const
   str << "\n pf_tol = " << pf_tol;
   str << "\n checkrun_reps = " << checkrun_reps;
   str << "\n reference_variant = " << reference_variant;
+  str << "\n compare_files = ";
+  for (size_t j = 0; j < compare_files.size(); ++j) {
+    str << "\n\t" << compare_files[j];
+  }
+  str << "\n compare_threshold = " << compare_threshold;
   str << "\n outdir = " << outdir;
   str << "\n outfile_prefix = " << outfile_prefix;
 
@@ -169,6 +249,100 @@ void RunParams::print(std::ostream& str) const
 }
 
 
+/*
+ *******************************************************************************
+ *
+ * Print run params used as a JSON object to given output stream.
+ *
+ *******************************************************************************
+ */
+void RunParams::printJSON(std::ostream& str) const
+{
+  auto printStrings = [&](const std::vector<std::string>& svec) {
+    str << "[";
+    for (size_t j = 0; j < svec.size(); ++j) {
+      str << (j > 0 ? "," : "") << getJSONString(svec[j]);
+    }
+    str << "]";
+  };
+
+  str << "{";
+  str << "\"npasses\":" << npasses;
+  str << ",\"npasses_combiners\":[";
+  for (size_t j = 0; j < npasses_combiners.size(); ++j) {
+    str << (j > 0 ? "," : "")
+        << getJSONString(CombinerOptToStr(npasses_combiners[j]));
+  }
+  str << "]";
+  str << ",\"rep_fact\":" << getJSONNumber(rep_fact);
+  str << ",\"sample_reps\":" << sample_reps;
+  str << ",\"histogram_bins\":" << histogram_bins;
+  str << ",\"adaptive_reps\":" << (adaptive_reps ? "true" : "false");
+  str << ",\"ci_target\":" << getJSONNumber(ci_target);
+  str << ",\"ci_max_time\":" << getJSONNumber(ci_max_time);
+  str << ",\"perf_counters\":[";
+  for (size_t j = 0; j < perf_counter_ids.size(); ++j) {
+    str << (j > 0 ? "," : "")
+        << getJSONString(getPerfCounterName(perf_counter_ids[j]));
+  }
+  str << "]";
+  str << ",\"roofline\":" << (roofline ? "true" : "false");
+  str << ",\"size_meaning\":" << getJSONString(SizeMeaningToStr(size_meaning));
+  str << ",\"size\":" << getJSONNumber(size);
+  str << ",\"size_factor\":" << getJSONNumber(size_factor);
+  str << ",\"size_sweep\":[";
+  for (size_t j = 0; j < size_sweep.size(); ++j) {
+    str << (j > 0 ? "," : "") << getJSONNumber(size_sweep[j]);
+  }
+  str << "]";
+  str << ",\"data_alignment\":" << data_alignment;
+  str << ",\"data_init_mode\":" << getJSONString(DataInitModeToStr(data_init_mode));
+  str << ",\"host_memory_mode\":" << getJSONString(HostMemoryModeToStr(host_memory_mode));
+  str << ",\"data_cache\":" << (data_cache ? "true" : "false");
+  str << ",\"cache_mode\":" << getJSONString(CacheModeToStr(cache_mode));
+  str << ",\"timer_backend\":" << getJSONString(TimerBackendToStr(timer_backend));
+  str << ",\"thread_sweep\":[";
+  for (size_t j = 0; j < thread_sweep.size(); ++j) {
+    str << (j > 0 ? "," : "") << thread_sweep[j];
+  }
+  str << "]";
+  str << ",\"weak_scaling\":" << (weak_scaling ? "true" : "false");
+  str << ",\"corun_instances\":" << corun_instances;
+  str << ",\"corun_kernel_input\":"; printStrings(corun_kernel_input);
+  str << ",\"thread_binding\":" << getJSONString(ThreadBindingToStr(thread_binding));
+  str << ",\"thread_bind_cpus\":[";
+  for (size_t j = 0; j < thread_bind_cpus.size(); ++j) {
+    str << (j > 0 ? "," : "") << thread_bind_cpus[j];
+  }
+  str << "]";
+  str << ",\"omp_schedules\":[";
+  for (size_t j = 0; j < omp_schedules.size(); ++j) {
+    str << (j > 0 ? "," : "")
+        << getJSONString(OpenMPScheduleToStr(omp_schedules[j]));
+  }
+  str << "]";
+  str << ",\"gpu_block_sizes\":[";
+  for (size_t j = 0; j < gpu_block_sizes.size(); ++j) {
+    str << (j > 0 ? "," : "") << gpu_block_sizes[j];
+  }
+  str << "]";
+  str << ",\"pf_tol\":" << getJSONNumber(pf_tol);
+  str << ",\"checkrun_reps\":" << checkrun_reps;
+  str << ",\"reference_variant\":" << getJSONString(reference_variant);
+  str << ",\"compare_files\":"; printStrings(compare_files);
+  str << ",\"compare_threshold\":" << getJSONNumber(compare_threshold);
+  str << ",\"kernel_input\":"; printStrings(kernel_input);
+  str << ",\"exclude_kernel_input\":"; printStrings(exclude_kernel_input);
+  str << ",\"variant_input\":"; printStrings(variant_input);
+  str << ",\"exclude_variant_input\":"; printStrings(exclude_variant_input);
+  str << ",\"feature_input\":"; printStrings(feature_input);
+  str << ",\"exclude_feature_input\":"; printStrings(exclude_feature_input);
+  str << ",\"outdir\":" << getJSONString(outdir);
+  str << ",\"outfile_prefix\":" << getJSONString(outfile_prefix);
+  str << "}";
+}
+
+
 /*
  *******************************************************************************
  *
@@ -264,6 +438,121 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--sample-reps") ) {
+
+      i++;
+      if ( i < argc ) {
+        sample_reps = ::atoi( argv[i] );
+        if ( sample_reps < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --sample-reps a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --sample-reps a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram-bins") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_bins = ::atoi( argv[i] );
+        if ( histogram_bins <= 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram-bins a POSITIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram-bins a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--reps") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string reps_mode(argv[i]);
+        if ( reps_mode == std::string("auto") ) {
+          adaptive_reps = true;
+        } else if ( reps_mode == std::string("fixed") ) {
+          adaptive_reps = false;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --reps auto or fixed"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --reps a value (auto or fixed)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ci") ) {
+
+      i++;
+      if ( i < argc ) {
+        ci_target = ::atof( argv[i] );
+        if ( ci_target <= 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ci a POSITIVE value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ci a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--ci-max-time") ) {
+
+      i++;
+      if ( i < argc ) {
+        ci_max_time = ::atof( argv[i] );
+        if ( ci_max_time <= 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --ci-max-time a POSITIVE value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --ci-max-time a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--roofline") ) {
+
+      roofline = true;
+
+    } else if ( opt == std::string("--perf-counters") ) {
+
+      perf_counters = true;
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          perf_counter_input.push_back(opt);
+          ++i;
+        }
+      }
+
     } else if ( opt == std::string("--sizefact") ) {
 
       i++;
@@ -291,6 +580,207 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--data-init") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string init_mode(argv[i]);
+        if ( init_mode == DataInitModeToStr(DataInitMode::SerialInit) ) {
+          data_init_mode = DataInitMode::SerialInit;
+        } else if ( init_mode == DataInitModeToStr(DataInitMode::ParallelInit) ) {
+          data_init_mode = DataInitMode::ParallelInit;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --data-init serial or parallel"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --data-init a value (serial or parallel)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--host-memory") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string mem_mode(argv[i]);
+        bool found_it = false;
+        for (HostMemoryMode hmm : { HostMemoryMode::AlignedMemory,
+                                    HostMemoryMode::HugeTLBMemory,
+                                    HostMemoryMode::THPMemory,
+                                    HostMemoryMode::PopulateMemory }) {
+          if ( mem_mode == HostMemoryModeToStr(hmm) ) {
+            host_memory_mode = hmm;
+            found_it = true;
+          }
+        }
+        if ( !found_it ) {
+          getCout() << "\nBad input:"
+                    << " must give --host-memory aligned, hugetlb, thp, or populate"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --host-memory a value (aligned, hugetlb, thp, or populate)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--data-cache") ) {
+
+      data_cache = true;
+
+    } else if ( opt == std::string("--cache") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string mode(argv[i]);
+        if ( mode == CacheModeToStr(CacheMode::WarmCache) ) {
+          cache_mode = CacheMode::WarmCache;
+        } else if ( mode == CacheModeToStr(CacheMode::ColdCache) ) {
+          cache_mode = CacheMode::ColdCache;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --cache warm or cold"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --cache a value (warm or cold)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--timer") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string backend(argv[i]);
+        if ( backend == TimerBackendToStr(TimerBackend::RAJATimer) ) {
+          timer_backend = TimerBackend::RAJATimer;
+        } else if ( backend == TimerBackendToStr(TimerBackend::TSCTimer) ) {
+          timer_backend = TimerBackend::TSCTimer;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --timer raja or tsc"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --timer a value (raja or tsc)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--thread-sweep") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          std::istringstream counts(opt);
+          std::string count;
+          while ( std::getline(counts, count, ',') ) {
+            int num_threads = ::atoi( count.c_str() );
+            if ( num_threads <= 0 ) {
+              getCout() << "\nBad input:"
+                        << " must give --thread-sweep POSITIVE values (int)"
+                        << std::endl;
+              input_state = BadInput;
+            } else {
+              thread_sweep.push_back(num_threads);
+            }
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --thread-sweep one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--weak-scaling") ) {
+
+      weak_scaling = true;
+
+    } else if ( opt == std::string("--corun") ) {
+
+      i++;
+      if ( i < argc ) {
+        corun_instances = ::atoi( argv[i] );
+        if ( corun_instances < 2 ) {
+          getCout() << "\nBad input:"
+                    << " must give --corun a value of at least 2 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --corun a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--corun-kernels") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          corun_kernel_input.push_back(opt);
+          ++i;
+        }
+      }
+      if ( corun_kernel_input.size() < 2 ) {
+        getCout() << "\nBad input:"
+                  << " must give --corun-kernels two or more kernel names"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--thread-bind") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string binding(argv[i]);
+        if ( binding == ThreadBindingToStr(ThreadBinding::CompactBinding) ) {
+          thread_binding = ThreadBinding::CompactBinding;
+        } else if ( binding == ThreadBindingToStr(ThreadBinding::SpreadBinding) ) {
+          thread_binding = ThreadBinding::SpreadBinding;
+        } else if ( detail::parseCPUList(binding, thread_bind_cpus) ) {
+          thread_binding = ThreadBinding::ListBinding;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --thread-bind compact, spread, or a CPU list"
+                    << " (e.g., 0-3,8)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --thread-bind a value (compact, spread, or a CPU list)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--size") ) {
 
       i++;
@@ -318,6 +808,36 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--size-sweep") ) {
+
+      i++;
+      if ( i < argc ) {
+        double size_min = 0.0;
+        double size_max = 0.0;
+        double size_ratio = 0.0;
+        char extra = '\0';
+        if ( std::sscanf(argv[i], "%lf:%lf:%lf%c",
+                         &size_min, &size_max, &size_ratio, &extra) != 3 ||
+             size_min <= 0.0 || size_max < size_min || size_ratio <= 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --size-sweep min:max:ratio with"
+                    << " 0 < min <= max and ratio > 1"
+                    << std::endl;
+          input_state = BadInput;
+        } else {
+          size_sweep.clear();
+          for (double sweep_size = size_min; sweep_size <= size_max;
+               sweep_size *= size_ratio) {
+            size_sweep.push_back(sweep_size);
+          }
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --size-sweep a value (min:max:ratio)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("-align") ||
                 opt == std::string("--data_alignment") ) {
 
@@ -345,6 +865,71 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--omp_schedule") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          // kind[,chunk] as in OMP_SCHEDULE
+          size_t comma = opt.find(',');
+          std::string kind = opt.substr(0, comma);
+          OpenMPSchedule sched{OpenMPScheduleKind::StaticSchedule, 0};
+          bool good = true;
+          if ( kind == OpenMPScheduleKindToStr(OpenMPScheduleKind::StaticSchedule) ) {
+            sched.kind = OpenMPScheduleKind::StaticSchedule;
+          } else if ( kind == OpenMPScheduleKindToStr(OpenMPScheduleKind::DynamicSchedule) ) {
+            sched.kind = OpenMPScheduleKind::DynamicSchedule;
+          } else if ( kind == OpenMPScheduleKindToStr(OpenMPScheduleKind::GuidedSchedule) ) {
+            sched.kind = OpenMPScheduleKind::GuidedSchedule;
+          } else {
+            good = false;
+          }
+          if ( comma != std::string::npos ) {
+            sched.chunk = ::atoi( opt.substr(comma+1).c_str() );
+            good = good && sched.chunk > 0;
+          }
+          if ( !good ) {
+            getCout() << "\nBad input:"
+                      << " must give --omp_schedule values static, dynamic,"
+                      << " or guided, each with optional POSITIVE chunk size"
+                      << " (e.g., dynamic,4)"
+                      << std::endl;
+            input_state = BadInput;
+          } else if ( sched.kind == OpenMPScheduleKind::StaticSchedule &&
+                      sched.chunk == 0 ) {
+            // the default tuning already runs with this schedule
+            getCout() << "\nBad input:"
+                      << " --omp_schedule static without a chunk size is"
+                      << " the default tuning"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            bool found = false;
+            for (const OpenMPSchedule& other : omp_schedules) {
+              found = found || ( other.kind == sched.kind &&
+                                 other.chunk == sched.chunk );
+            }
+            if ( !found ) {
+              omp_schedules.push_back(sched);
+            }
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omp_schedule one or more values"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--gpu_block_size") ) {
 
       bool got_someting = false;
@@ -389,6 +974,47 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--compare") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          compare_files.push_back(opt);
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --compare one or more file names"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--compare-threshold") ) {
+
+      i++;
+      if ( i < argc ) {
+        compare_threshold = ::atof( argv[i] );
+        if ( compare_threshold < 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --compare-threshold a NON-NEGATIVE value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --compare-threshold a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--kernels") ||
                 opt == std::string("-k") ) {
 
@@ -557,6 +1183,28 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
 
   }
 
+  // Co-run instances must run for the same time, and caches are shared
+  if ( (corun_instances > 0 || !corun_kernel_input.empty()) &&
+       (adaptive_reps || cache_mode == CacheMode::ColdCache) ) {
+    getCout() << "\nBad input:"
+              << " may not set --adaptive-reps or --cache cold with"
+              << " --corun or --corun-kernels"
+              << std::endl;
+    input_state = BadInput;
+  }
+
+  // Main run uses first size of size sweep
+  if (!size_sweep.empty()) {
+    if (size_meaning != SizeMeaning::Unset) {
+      getCout() << "\nBad input:"
+                << " may not set --size or --sizefact with --size-sweep"
+                << std::endl;
+      input_state = BadInput;
+    } else {
+      setSize(size_sweep.front());
+    }
+  }
+
   // Default size and size_meaning if unset
   if (size_meaning == SizeMeaning::Unset) {
     size_meaning = SizeMeaning::Factor;
@@ -607,6 +1255,64 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --repfact 0.5 (runs kernels 1/2 as many times as default)\n\n";
 
+  str << "\t --sample-reps <int> [default is 0]\n"
+      << "\t      (num kernel reps timed in each timing sample; 0 times all reps as one sample)\n"
+      << "\t      (when > 0, per-rep timing statistics and histograms are written to output files)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --sample-reps 1 (time each kernel rep separately)\n"
+      << "\t\t --sample-reps 10 (time each batch of 10 kernel reps separately)\n\n";
+
+  str << "\t --histogram-bins <int> [default is 20]\n"
+      << "\t      (num bins in timing sample histograms; used with --sample-reps)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram-bins 50 (histograms of per-rep times will have 50 bins)\n\n";
+
+  str << "\t --reps <string> [default is fixed]\n"
+      << "\t      (fixed runs default num reps of each kernel scaled by --repfact)\n"
+      << "\t      (auto runs reps in timing samples until 95% confidence interval of\n"
+      << "\t       per-rep time is within --ci of mean or --ci-max-time is reached)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --reps auto --ci 1 (run until per-rep time is known within 1%)\n\n";
+
+  str << "\t --ci <double> [default is 1.0]\n"
+      << "\t      (target half-width of 95% confidence interval of per-rep time,\n"
+      << "\t       as pct of mean; used with --reps auto)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ci 0.5 (stop when per-rep time is known within 0.5%)\n\n";
+
+  str << "\t --ci-max-time <double> [default is 10.0]\n"
+      << "\t      (max time in sec. spent running each kernel variant; used with --reps auto)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --ci-max-time 2.5 (run each kernel variant at most ~2.5 sec.)\n\n";
+
+  str << "\t --cache <string> [default is warm]\n"
+      << "\t      (cache state in which kernel reps are timed)\n"
+      << "\t      (warm runs reps back-to-back on the same data)\n"
+      << "\t      (cold evicts host caches before each rep and times each rep\n"
+      << "\t       separately; eviction time is not measured)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --cache cold (time kernels as if called once per timestep)\n\n";
+
+  str << "\t --timer <string> [default is raja]\n"
+      << "\t      (timer used to time kernel reps)\n"
+      << "\t      (raja uses RAJA::Timer)\n"
+      << "\t      (tsc reads the invariant time stamp counter, if it can be\n"
+      << "\t       trusted, else raja is used)\n"
+      << "\t      (timer overhead is measured at startup and subtracted)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --timer tsc (time small problem sizes with less overhead)\n\n";
+
+  str << "\t --roofline (measure host bandwidth of each cache level and DRAM and peak\n"
+      << "\t      FLOP rate before running kernels, and generate roofline report\n"
+      << "\t      for sequential and OpenMP variants)\n\n";
+
+  str << "\t --perf-counters [<space-separated strings>] [Default is all]\n"
+      << "\t      (collect hardware counters while kernels are timed; Linux only)\n"
+      << "\t      (counters: cycles instructions LLC-misses dTLB-misses branch-misses)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --perf-counters (collect all counters)\n"
+      << "\t\t --perf-counters cycles instructions (collect cycles and instructions)\n\n";
+
   str << "\t --sizefact <double> [default is 1.0]\n"
       << "\t      (fraction of default kernel sizes to run)\n"
       << "\t      (may not be set if --size is set)\n";
@@ -619,12 +1325,81 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --size 1000000 (runs kernels with size ~1,000,000)\n\n";
 
+  str << "\t --size-sweep <min:max:ratio> [no default]\n"
+      << "\t      (run all kernels with sizes min, min*ratio, ... up to max, and\n"
+      << "\t       generate report of time, GB/s, and GFLOP/s versus size)\n"
+      << "\t      (main run uses size min; may not be set with --size or --sizefact)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --size-sweep 1000:100000000:2 (sizes 1K, 2K, 4K, ... up to 100M)\n\n";
+
   str << "\t --data_alignment, -align <int> [default is RAJA::DATA_ALIGN]\n"
       << "\t      (minimum memory alignment for host allocations)\n"
       << "\t      (must be a power of 2 at least as large as the default alignment)\n";
   str << "\t\t Example...\n"
       << "\t\t -align 4096 (allocates memory aligned to 4KiB boundaries)\n\n";
 
+  str << "\t --host-memory <string> [default is aligned]\n"
+      << "\t      (how host data arrays are allocated)\n"
+      << "\t      (aligned uses aligned malloc with --data_alignment)\n"
+      << "\t      (hugetlb uses mmap with explicit huge pages; falls back to thp if none are available)\n"
+      << "\t      (thp uses aligned malloc advised to use transparent huge pages)\n"
+      << "\t      (populate uses mmap with all pages faulted in on allocation)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --host-memory thp (back host data with transparent huge pages)\n\n";
+
+  str << "\t --data-init <string> [default is parallel]\n"
+      << "\t      (how host data is initialized for OpenMP variants)\n"
+      << "\t      (parallel first touches data with same static partition as kernels)\n"
+      << "\t      (serial initializes data on one thread; data values are the same)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --data-init serial (place all data pages near main thread)\n\n";
+
+  str << "\t --thread-sweep <comma or space-separated ints> [no default]\n"
+      << "\t      (after the main run, run OpenMP variants again with each number\n"
+      << "\t       of threads and generate scaling speedup and efficiency reports)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --thread-sweep 1,2,4,8,16 (run OpenMP variants with 1 to 16 threads)\n\n";
+
+  str << "\t --weak-scaling (problem size in thread sweep is per thread; kernels\n"
+      << "\t      run with problem size times number of threads)\n\n";
+
+  str << "\t --corun <int> [no default]\n"
+      << "\t      (after the main run, run this many instances of each kernel at\n"
+      << "\t       the same time, each on its own part of the available CPUs, and\n"
+      << "\t       generate report of slowdown relative to each running alone)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --corun 4 (run 4 instances of each kernel on 1/4 of CPUs each)\n\n";
+
+  str << "\t --corun-kernels <space-separated strings> [no default]\n"
+      << "\t      (after the main run, run one instance of each named kernel at\n"
+      << "\t       the same time, each on its own part of the available CPUs;\n"
+      << "\t       a name may be repeated to run more instances)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --corun-kernels Stream_TRIAD Apps_VOL3D Apps_VOL3D\n\n";
+
+  str << "\t --thread-bind <string> [default is none]\n"
+      << "\t      (bind OpenMP threads to CPUs before OpenMP variants run;\n"
+      << "\t       by default placement is left to OMP_PROC_BIND and OMP_PLACES)\n"
+      << "\t      (compact binds threads to consecutive available CPUs)\n"
+      << "\t      (spread binds threads evenly over available CPUs)\n"
+      << "\t      (a CPU list binds thread i to ith CPU in the list)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --thread-bind spread (one thread per socket first on two socket nodes)\n"
+      << "\t\t --thread-bind 0-7,16-23 (bind 16 threads to CPUs 0-7 and 16-23)\n\n";
+
+  str << "\t --data-cache (keep host data of a kernel between its variant, tuning,\n"
+      << "\t      and pass runs; arrays a run modified are initialized again\n"
+      << "\t      before the next run instead of being reallocated)\n\n";
+
+  str << "\t --omp_schedule <space-separated schedules> [no default]\n"
+      << "\t      (OpenMP loop schedules, kind[,chunk] with kind static, dynamic,\n"
+      << "\t       or guided, to run as extra tunings of OpenMP kernels that\n"
+      << "\t       use the default OpenMP tuning; static needs a chunk size\n"
+      << "\t       since the default tuning already uses a static schedule)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --omp_schedule static,16 dynamic,4 guided (runs OpenMP kernels with\n"
+      << "\t\t   default schedule and these three schedules)\n\n";
+
   str << "\t --gpu_block_size <space-separated ints> [no default]\n"
       << "\t      (block sizes to run for all GPU kernels)\n"
       << "\t      (GPU kernels not supporting gpu_block_size will be skipped)\n"
@@ -692,6 +1467,20 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --refvar Base_Seq (speedups reported relative to Base_Seq variants)\n\n";
 
+  str << "\t --compare <space-separated strings> [Default is none]\n"
+      << "\t      (data (*-data.jsonl) or timing (*-timing-*.csv) files of previous\n"
+      << "\t       runs to compare with; generates report of time ratio for each\n"
+      << "\t       kernel variant tuning and exits with non-zero status if there\n"
+      << "\t       is a regression)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --compare old/RAJAPerf-data.jsonl (compare with run in old directory)\n\n";
+
+  str << "\t --compare-threshold <double> [default is 5.0]\n"
+      << "\t      (pct slowdown relative to a previous run that is a regression,\n"
+      << "\t       if slowdown is statistically significant)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --compare-threshold 10.0 (regression if 10% slower)\n\n";
+
   str << "\t --dryrun (print summary of how Suite will run without running it)\n\n";
 
   str << "\t --checkrun <int> [default is 1]\n"
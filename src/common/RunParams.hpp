@@ -14,6 +14,7 @@
 #include <iosfwd>
 
 #include "RAJAPerfSuite.hpp"
+#include "PerfCounters.hpp"
 
 namespace rajaperf
 {
@@ -91,6 +92,168 @@ public:
     }
   }
 
+  /*!
+   * \brief Enumeration indicating how data for OpenMP variants is initialized
+   */
+  enum DataInitMode {
+    SerialInit,     /*!< initialize data on one thread */
+    ParallelInit,   /*!< first touch data with same static partition
+                         as kernels, compute values in parallel when
+                         they don't depend on a random sequence */
+  };
+
+  static std::string DataInitModeToStr(DataInitMode dim)
+  {
+    switch (dim) {
+      case DataInitMode::SerialInit:
+        return "serial";
+      case DataInitMode::ParallelInit:
+        return "parallel";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration indicating how OpenMP threads are bound to CPUs
+   */
+  enum ThreadBinding {
+    NoBinding,        /*!< placement left to OpenMP runtime
+                           (OMP_PROC_BIND, OMP_PLACES) */
+    CompactBinding,   /*!< threads on consecutive available CPUs */
+    SpreadBinding,    /*!< threads spread evenly over available CPUs */
+    ListBinding,      /*!< threads on CPUs in given list, in order */
+  };
+
+  static std::string ThreadBindingToStr(ThreadBinding tb)
+  {
+    switch (tb) {
+      case ThreadBinding::NoBinding:
+        return "none";
+      case ThreadBinding::CompactBinding:
+        return "compact";
+      case ThreadBinding::SpreadBinding:
+        return "spread";
+      case ThreadBinding::ListBinding:
+        return "list";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration indicating OpenMP loop schedule kind
+   */
+  enum OpenMPScheduleKind {
+    StaticSchedule,   /*!< iterations split into equal parts, or chunks
+                           dealt round-robin */
+    DynamicSchedule,  /*!< chunks taken by threads as they finish */
+    GuidedSchedule,   /*!< chunks taken as threads finish, of decreasing
+                           size down to chunk size */
+  };
+
+  static std::string OpenMPScheduleKindToStr(OpenMPScheduleKind sk)
+  {
+    switch (sk) {
+      case OpenMPScheduleKind::StaticSchedule:
+        return "static";
+      case OpenMPScheduleKind::DynamicSchedule:
+        return "dynamic";
+      case OpenMPScheduleKind::GuidedSchedule:
+        return "guided";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief OpenMP loop schedule of an OpenMP schedule tuning; chunk size
+   *        0 is the default chunk size of the schedule kind.
+   */
+  struct OpenMPSchedule
+  {
+    OpenMPScheduleKind kind;
+    int chunk;
+  };
+
+  // name of schedule tuning, e.g. "static", "dynamic_4"
+  static std::string OpenMPScheduleToStr(const OpenMPSchedule& sched)
+  {
+    std::string str = OpenMPScheduleKindToStr(sched.kind);
+    if ( sched.chunk > 0 ) {
+      str += "_" + std::to_string(sched.chunk);
+    }
+    return str;
+  }
+
+  /*!
+   * \brief Enumeration indicating cache state in which kernel reps are timed
+   */
+  enum CacheMode {
+    WarmCache,      /*!< reps run back-to-back on same data */
+    ColdCache,      /*!< host caches scrubbed before each rep; each rep
+                         is timed separately */
+  };
+
+  static std::string CacheModeToStr(CacheMode cm)
+  {
+    switch (cm) {
+      case CacheMode::WarmCache:
+        return "warm";
+      case CacheMode::ColdCache:
+        return "cold";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration indicating timer used to time kernel reps
+   */
+  enum TimerBackend {
+    RAJATimer,      /*!< RAJA::Timer (std::chrono by default) */
+    TSCTimer,       /*!< invariant time stamp counter (x86) */
+  };
+
+  static std::string TimerBackendToStr(TimerBackend tb)
+  {
+    switch (tb) {
+      case TimerBackend::RAJATimer:
+        return "raja";
+      case TimerBackend::TSCTimer:
+        return "tsc";
+      default:
+        return "Unknown";
+    }
+  }
+
+  /*!
+   * \brief Enumeration indicating how host data arrays are allocated
+   */
+  enum HostMemoryMode {
+    AlignedMemory,    /*!< aligned malloc */
+    HugeTLBMemory,    /*!< mmap with explicit huge pages (MAP_HUGETLB) */
+    THPMemory,        /*!< aligned malloc with transparent huge pages
+                           (madvise MADV_HUGEPAGE) */
+    PopulateMemory,   /*!< mmap with pages pre-faulted (MAP_POPULATE) */
+  };
+
+  static std::string HostMemoryModeToStr(HostMemoryMode hmm)
+  {
+    switch (hmm) {
+      case HostMemoryMode::AlignedMemory:
+        return "aligned";
+      case HostMemoryMode::HugeTLBMemory:
+        return "hugetlb";
+      case HostMemoryMode::THPMemory:
+        return "thp";
+      case HostMemoryMode::PopulateMemory:
+        return "populate";
+      default:
+        return "Unknown";
+    }
+  }
+
 //@{
 //! @name Methods to get/set input state
 
@@ -112,6 +275,23 @@ public:
   int getNumPasses() const { return npasses; }
 
   double getRepFactor() const { return rep_fact; }
+  void setRepFactor(double fact) { rep_fact = fact; }
+
+  int getSampleReps() const { return sample_reps; }
+
+  int getHistogramBins() const { return histogram_bins; }
+
+  bool getAdaptiveReps() const { return adaptive_reps; }
+  double getCITarget() const { return ci_target; }
+  double getCIMaxTime() const { return ci_max_time; }
+
+  bool getPerfCounters() const { return perf_counters; }
+  const std::vector<PerfCounterID>& getPerfCounterIDs() const
+  { return perf_counter_ids; }
+  void setPerfCounterIDs( std::vector<PerfCounterID>& pcvec )
+  { perf_counter_ids = pcvec; }
+
+  bool getRoofline() const { return roofline; }
 
   const std::vector<CombinerOpt>& getNpassesCombinerOpts() const
   { return npasses_combiners; }
@@ -125,8 +305,48 @@ public:
 
   double getSizeFactor() const { return size_factor; }
 
+  void setSize(double s) { size_meaning = SizeMeaning::Direct; size = s; }
+
+  const std::vector<double>& getSizeSweep() const { return size_sweep; }
+
   size_t getDataAlignment() const { return data_alignment; }
 
+  DataInitMode getDataInitMode() const { return data_init_mode; }
+
+  HostMemoryMode getHostMemoryMode() const { return host_memory_mode; }
+
+  bool getDataCache() const { return data_cache; }
+
+  CacheMode getCacheMode() const { return cache_mode; }
+
+  TimerBackend getTimerBackend() const { return timer_backend; }
+
+  const std::vector<int>& getThreadSweep() const { return thread_sweep; }
+  bool getWeakScaling() const { return weak_scaling; }
+
+  /*!
+   * \brief Multiply kernel problem sizes by given factor, whether sizes are
+   *        set directly or as a factor of default sizes.
+   */
+  void scaleProblemSize(double factor)
+  {
+    if ( size_meaning == SizeMeaning::Direct ) {
+      size *= factor;
+    } else {
+      size_factor *= factor;
+    }
+  }
+
+  int getCorunInstances() const { return corun_instances; }
+  const std::vector<std::string>& getCorunKernelInput() const
+                                  { return corun_kernel_input; }
+
+  ThreadBinding getThreadBinding() const { return thread_binding; }
+  const std::vector<int>& getThreadBindCPUs() const { return thread_bind_cpus; }
+
+  const std::vector<OpenMPSchedule>& getOpenMPSchedules() const
+                                     { return omp_schedules; }
+
   size_t numValidGPUBlockSize() const { return gpu_block_sizes.size(); }
   bool validGPUBlockSize(size_t block_size) const
   {
@@ -144,6 +364,11 @@ public:
 
   const std::string& getReferenceVariant() const { return reference_variant; }
 
+  const std::vector<std::string>& getCompareFiles() const
+                                  { return compare_files; }
+
+  double getCompareThreshold() const { return compare_threshold; }
+
   const std::vector<std::string>& getKernelInput() const
                                   { return kernel_input; }
   void setInvalidKernelInput( std::vector<std::string>& svec )
@@ -193,6 +418,13 @@ public:
   void setInvalidNpassesCombinerOptInput( std::vector<std::string>& svec )
                               { invalid_npasses_combiner_input = svec; }
 
+  const std::vector<std::string>& getPerfCounterInput() const
+                                  { return perf_counter_input; }
+  const std::vector<std::string>& getInvalidPerfCounterInput() const
+                                  { return invalid_perf_counter_input; }
+  void setInvalidPerfCounterInput( std::vector<std::string>& svec )
+                              { invalid_perf_counter_input = svec; }
+
   const std::string& getOutputDirName() const { return outdir; }
   const std::string& getOutputFilePrefix() const { return outfile_prefix; }
 
@@ -203,6 +435,11 @@ public:
    */
   void print(std::ostream& str) const;
 
+  /*!
+   * \brief Print run params used as a JSON object to given output stream.
+   */
+  void printJSON(std::ostream& str) const;
+
 
 private:
   RunParams() = delete;
@@ -231,10 +468,56 @@ private:
 
   double rep_fact;       /*!< pct of default kernel reps to run */
 
+  int sample_reps;       /*!< Num reps in each separately timed sample
+                              (0 -> time all reps as one sample) */
+  int histogram_bins;    /*!< Num bins in timing sample histograms */
+
+  bool adaptive_reps;    /*!< true -> run reps until timing converges */
+  double ci_target;      /*!< target relative half-width (pct) of 95%
+                              confidence interval of per-rep time */
+  double ci_max_time;    /*!< max time (sec.) to run a kernel variant
+                              when reps are adaptive */
+
+  bool perf_counters;    /*!< true -> collect hardware counters */
+  std::vector<PerfCounterID> perf_counter_ids; /*!< hardware counters
+                                                    to collect */
+
+  bool roofline;         /*!< true -> measure machine peaks and
+                              generate roofline report */
+
   SizeMeaning size_meaning; /*!< meaning of size value */
   double size;           /*!< kernel size to run (input option) */
   double size_factor;    /*!< default kernel size multipier (input option) */
+  std::vector<double> size_sweep; /*!< kernel sizes to run in size sweep,
+                                       first is size of main run
+                                       (input option) */
   size_t data_alignment;
+  DataInitMode data_init_mode; /*!< how data for OpenMP variants is
+                                    initialized (input option) */
+  HostMemoryMode host_memory_mode; /*!< how host data arrays are
+                                        allocated (input option) */
+  bool data_cache;       /*!< true -> reuse kernel host data across runs
+                              of the same kernel (input option) */
+  CacheMode cache_mode;  /*!< cache state in which reps are timed
+                              (input option) */
+  TimerBackend timer_backend; /*!< timer used to time reps (input option) */
+  std::vector<int> thread_sweep; /*!< OpenMP thread counts to run OpenMP
+                                      variants with (input option) */
+  bool weak_scaling;     /*!< true -> problem size in thread sweep is per
+                              thread (input option) */
+  int corun_instances;   /*!< Num instances of each kernel to run at the
+                              same time on disjoint CPUs (input option) */
+  std::vector<std::string> corun_kernel_input; /*!< Names of kernels to run
+                                                    at the same time on
+                                                    disjoint CPUs
+                                                    (input option) */
+  ThreadBinding thread_binding; /*!< how OpenMP threads are bound to CPUs
+                                     (input option) */
+  std::vector<int> thread_bind_cpus; /*!< CPUs for list binding
+                                          (input option) */
+  std::vector<OpenMPSchedule> omp_schedules; /*!< OpenMP loop schedules of
+                                                  OpenMP tunings to run
+                                                  (input option) */
   std::vector<size_t> gpu_block_sizes; /*!< Block sizes for gpu tunings to run (input option) */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
@@ -245,6 +528,11 @@ private:
   std::string reference_variant;   /*!< Name of reference variant for speedup
                                         calculations */
 
+  std::vector<std::string> compare_files; /*!< Result files of previous runs
+                                               to compare with (input option) */
+  double compare_threshold; /*!< pct slowdown relative to a previous run
+                                 that is a regression (input option) */
+
   //
   // Arrays to hold input strings for valid/invalid input. Helpful for
   // debugging command line args.
@@ -265,6 +553,9 @@ private:
   std::vector<std::string> npasses_combiner_input;
   std::vector<std::string> invalid_npasses_combiner_input;
 
+  std::vector<std::string> perf_counter_input;
+  std::vector<std::string> invalid_perf_counter_input;
+
   std::string outdir;          /*!< Output directory name. */
   std::string outfile_prefix;  /*!< Prefix for output data file names. */
 
@@ -0,0 +1,420 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Vector packs and loop helpers for explicit SIMD kernel variants.
+///
+/// Packs use std::experimental::simd when it is available (C++17 builds
+/// with a standard library that has it), else SSE2, AVX, or AVX-512
+/// intrinsics for Real_type double packs that fit the target ISA, else
+/// arrays with fixed-length loops the compiler may vectorize.
+///
+
+#ifndef RAJAPerf_SIMDUtils_HPP
+#define RAJAPerf_SIMDUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/GPUUtils.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define RAJAPERF_HAVE_STD_SIMD
+#endif
+#endif
+
+#if !defined(RAJAPERF_HAVE_STD_SIMD) && defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace simd
+{
+
+// pack widths and unroll factors of SIMD variant tunings
+using widths_type = rajaperf::configuration::simd_widths;
+using unrolls_type = rajaperf::configuration::simd_unrolls;
+
+/*!
+ * \brief Return name of pack implementation in use.
+ */
+inline std::string getBackendName()
+{
+#if defined(RAJAPERF_HAVE_STD_SIMD)
+  return "std::experimental::simd";
+#elif defined(__AVX512F__)
+  return "AVX-512 intrinsics";
+#elif defined(__AVX__)
+  return "AVX intrinsics";
+#elif defined(__SSE2__)
+  return "SSE2 intrinsics";
+#else
+  return "scalar loops";
+#endif
+}
+
+
+#if defined(RAJAPERF_HAVE_STD_SIMD)
+
+/*!
+ * \brief Pack of width values of type T operated on together.
+ */
+template < typename T, size_t width >
+class Pack
+{
+  using simd_type = std::experimental::fixed_size_simd<T, width>;
+
+public:
+  using mask_type = typename simd_type::mask_type;
+
+  Pack() = default;
+  Pack(T val) : v(val) { }
+
+  static Pack load(const T* ptr)
+  { Pack p; p.v.copy_from(ptr, std::experimental::element_aligned); return p; }
+  void store(T* ptr) const
+  { v.copy_to(ptr, std::experimental::element_aligned); }
+
+  // pack of start, start+1, ...
+  static Pack iota(T start)
+  { Pack p; p.v = simd_type([=](auto l) { return start + T(l); }); return p; }
+
+  T operator[](size_t l) const { return v[l]; }
+
+  friend Pack operator+(Pack a, Pack b) { return Pack(a.v + b.v); }
+  friend Pack operator-(Pack a, Pack b) { return Pack(a.v - b.v); }
+  friend Pack operator*(Pack a, Pack b) { return Pack(a.v * b.v); }
+  friend Pack operator/(Pack a, Pack b) { return Pack(a.v / b.v); }
+  friend Pack operator-(Pack a) { return Pack(-a.v); }
+
+  friend mask_type operator<(Pack a, Pack b) { return a.v < b.v; }
+  friend mask_type operator>=(Pack a, Pack b) { return a.v >= b.v; }
+
+  // lanes of a where mask is set, else lanes of b
+  friend Pack select(mask_type m, Pack a, Pack b)
+  { std::experimental::where(m, b.v) = a.v; return b; }
+
+  friend Pack sqrt(Pack a) { return Pack(std::experimental::sqrt(a.v)); }
+  friend Pack exp(Pack a) { return Pack(std::experimental::exp(a.v)); }
+
+  friend T reduce_sum(Pack a) { return std::experimental::reduce(a.v); }
+
+  // pack of 0, a[0], a[0]+a[1], ...
+  friend Pack scan_exclusive(Pack a)
+  {
+    return Pack(simd_type([&](auto l) {
+      T sum = 0;
+      for (size_t k = 0; k < l; ++k) { sum += a.v[k]; }
+      return sum;
+    }));
+  }
+
+private:
+  explicit Pack(simd_type sv) : v(sv) { }
+
+  simd_type v;
+};
+
+#else  // no std::experimental::simd
+
+/*!
+ * \brief Pack of width values of type T operated on together.
+ */
+template < typename T, size_t width >
+class Pack
+{
+public:
+  struct mask_type { bool m[width]; };
+
+  Pack() = default;
+  Pack(T val) { for (size_t l = 0; l < width; ++l) { v[l] = val; } }
+
+  static Pack load(const T* ptr)
+  { Pack p; for (size_t l = 0; l < width; ++l) { p.v[l] = ptr[l]; } return p; }
+  void store(T* ptr) const
+  { for (size_t l = 0; l < width; ++l) { ptr[l] = v[l]; } }
+
+  // pack of start, start+1, ...
+  static Pack iota(T start)
+  { Pack p; for (size_t l = 0; l < width; ++l) { p.v[l] = start + T(l); } return p; }
+
+  T operator[](size_t l) const { return v[l]; }
+
+  friend Pack operator+(Pack a, Pack b)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] += b.v[l]; } return a; }
+  friend Pack operator-(Pack a, Pack b)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] -= b.v[l]; } return a; }
+  friend Pack operator*(Pack a, Pack b)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] *= b.v[l]; } return a; }
+  friend Pack operator/(Pack a, Pack b)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] /= b.v[l]; } return a; }
+  friend Pack operator-(Pack a)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] = -a.v[l]; } return a; }
+
+  friend mask_type operator<(Pack a, Pack b)
+  { mask_type r; for (size_t l = 0; l < width; ++l) { r.m[l] = a.v[l] < b.v[l]; } return r; }
+  friend mask_type operator>=(Pack a, Pack b)
+  { mask_type r; for (size_t l = 0; l < width; ++l) { r.m[l] = a.v[l] >= b.v[l]; } return r; }
+
+  // lanes of a where mask is set, else lanes of b
+  friend Pack select(mask_type m, Pack a, Pack b)
+  { for (size_t l = 0; l < width; ++l) { b.v[l] = m.m[l] ? a.v[l] : b.v[l]; } return b; }
+
+  friend Pack sqrt(Pack a)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] = std::sqrt(a.v[l]); } return a; }
+  friend Pack exp(Pack a)
+  { for (size_t l = 0; l < width; ++l) { a.v[l] = std::exp(a.v[l]); } return a; }
+
+  friend T reduce_sum(Pack a)
+  { T sum = a.v[0]; for (size_t l = 1; l < width; ++l) { sum += a.v[l]; } return sum; }
+
+  // pack of 0, a[0], a[0]+a[1], ...
+  friend Pack scan_exclusive(Pack a)
+  {
+    T sum = 0;
+    for (size_t l = 0; l < width; ++l) { T val = a.v[l]; a.v[l] = sum; sum += val; }
+    return a;
+  }
+
+private:
+  T v[width];
+};
+
+//
+// Intrinsics packs share exp with the array version: there is no vector
+// exp instruction, so it is computed lane by lane.
+//
+#define RAJAPERF_SIMD_INTRINSICS_PACK(width, vec_type, mask_t,                  \
+                                      set1, loadu, storeu,                      \
+                                      add, sub, mul, div, sqrt_,                \
+                                      cmplt, cmpge, blend, reduce, scan)        \
+template < >                                                                    \
+class Pack<double, width>                                                       \
+{                                                                               \
+public:                                                                         \
+  using mask_type = mask_t;                                                     \
+                                                                                \
+  Pack() = default;                                                             \
+  Pack(double val) : v(set1(val)) { }                                           \
+                                                                                \
+  static Pack load(const double* ptr) { return Pack(loadu(ptr)); }              \
+  void store(double* ptr) const { storeu(ptr, v); }                             \
+                                                                                \
+  static Pack iota(double start)                                                \
+  {                                                                             \
+    double lanes[width];                                                        \
+    for (size_t l = 0; l < width; ++l) { lanes[l] = start + double(l); }        \
+    return load(lanes);                                                         \
+  }                                                                             \
+                                                                                \
+  double operator[](size_t l) const                                             \
+  { double lanes[width]; store(lanes); return lanes[l]; }                       \
+                                                                                \
+  friend Pack operator+(Pack a, Pack b) { return Pack(add(a.v, b.v)); }         \
+  friend Pack operator-(Pack a, Pack b) { return Pack(sub(a.v, b.v)); }         \
+  friend Pack operator*(Pack a, Pack b) { return Pack(mul(a.v, b.v)); }         \
+  friend Pack operator/(Pack a, Pack b) { return Pack(div(a.v, b.v)); }         \
+  friend Pack operator-(Pack a) { return Pack(sub(set1(0.0), a.v)); }           \
+                                                                                \
+  friend mask_type operator<(Pack a, Pack b) { return cmplt(a.v, b.v); }        \
+  friend mask_type operator>=(Pack a, Pack b) { return cmpge(a.v, b.v); }       \
+                                                                                \
+  friend Pack select(mask_type m, Pack a, Pack b)                               \
+  { return Pack(blend(m, a.v, b.v)); }                                          \
+                                                                                \
+  friend Pack sqrt(Pack a) { return Pack(sqrt_(a.v)); }                         \
+  friend Pack exp(Pack a)                                                       \
+  {                                                                             \
+    double lanes[width];                                                        \
+    a.store(lanes);                                                             \
+    for (size_t l = 0; l < width; ++l) { lanes[l] = std::exp(lanes[l]); }       \
+    return load(lanes);                                                         \
+  }                                                                             \
+                                                                                \
+  friend double reduce_sum(Pack a) { return reduce(a.v); }                      \
+  friend Pack scan_exclusive(Pack a) { return Pack(scan(a.v)); }                \
+                                                                                \
+private:                                                                        \
+  explicit Pack(vec_type vv) : v(vv) { }                                        \
+                                                                                \
+  vec_type v;                                                                   \
+};
+
+#if defined(__SSE2__)
+namespace detail
+{
+// SSE2 has no blend instruction
+inline __m128d blend_sse2(__m128d m, __m128d a, __m128d b)
+{ return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+inline double reduce_sse2(__m128d a)
+{ return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a))); }
+inline __m128d scan_sse2(__m128d a)
+{ return _mm_unpacklo_pd(_mm_setzero_pd(), a); }
+}
+
+RAJAPERF_SIMD_INTRINSICS_PACK(2, __m128d, __m128d,
+    _mm_set1_pd, _mm_loadu_pd, _mm_storeu_pd,
+    _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_div_pd, _mm_sqrt_pd,
+    _mm_cmplt_pd, _mm_cmpge_pd, detail::blend_sse2, detail::reduce_sse2,
+    detail::scan_sse2)
+#endif
+
+#if defined(__AVX__)
+namespace detail
+{
+inline __m256d cmplt_avx(__m256d a, __m256d b)
+{ return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+inline __m256d cmpge_avx(__m256d a, __m256d b)
+{ return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+inline __m256d blend_avx(__m256d m, __m256d a, __m256d b)
+{ return _mm256_blendv_pd(b, a, m); }
+inline double reduce_avx(__m256d a)
+{
+  __m128d s = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+  return reduce_sse2(s);
+}
+// lanes shifted up by one, zero shifted in
+inline __m256d shift1_avx(__m256d a)
+{
+  __m256d t = _mm256_permute_pd(a, 0x5);
+  return _mm256_blend_pd(t, _mm256_permute2f128_pd(t, t, 0x08), 0x5);
+}
+inline __m256d scan_avx(__m256d a)
+{
+  __m256d s = shift1_avx(a);
+  s = _mm256_add_pd(s, shift1_avx(s));
+  return _mm256_add_pd(s, _mm256_permute2f128_pd(s, s, 0x08));
+}
+}
+
+RAJAPERF_SIMD_INTRINSICS_PACK(4, __m256d, __m256d,
+    _mm256_set1_pd, _mm256_loadu_pd, _mm256_storeu_pd,
+    _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_div_pd, _mm256_sqrt_pd,
+    detail::cmplt_avx, detail::cmpge_avx, detail::blend_avx, detail::reduce_avx,
+    detail::scan_avx)
+#endif
+
+#if defined(__AVX512F__)
+namespace detail
+{
+inline __mmask8 cmplt_avx512(__m512d a, __m512d b)
+{ return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+inline __mmask8 cmpge_avx512(__m512d a, __m512d b)
+{ return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+inline __m512d blend_avx512(__mmask8 m, __m512d a, __m512d b)
+{ return _mm512_mask_blend_pd(m, b, a); }
+inline double reduce_avx512(__m512d a)
+{ return _mm512_reduce_add_pd(a); }
+inline __m512d scan_avx512(__m512d a)
+{
+  const __m512i up1 = _mm512_set_epi64(6, 5, 4, 3, 2, 1, 0, 0);
+  const __m512i up2 = _mm512_set_epi64(5, 4, 3, 2, 1, 0, 0, 0);
+  const __m512i up4 = _mm512_set_epi64(3, 2, 1, 0, 0, 0, 0, 0);
+  __m512d s = _mm512_maskz_permutexvar_pd(0xFE, up1, a);
+  s = _mm512_add_pd(s, _mm512_maskz_permutexvar_pd(0xFE, up1, s));
+  s = _mm512_add_pd(s, _mm512_maskz_permutexvar_pd(0xFC, up2, s));
+  return _mm512_add_pd(s, _mm512_maskz_permutexvar_pd(0xF0, up4, s));
+}
+}
+
+RAJAPERF_SIMD_INTRINSICS_PACK(8, __m512d, __mmask8,
+    _mm512_set1_pd, _mm512_loadu_pd, _mm512_storeu_pd,
+    _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd, _mm512_div_pd, _mm512_sqrt_pd,
+    detail::cmplt_avx512, detail::cmpge_avx512, detail::blend_avx512,
+    detail::reduce_avx512, detail::scan_avx512)
+#endif
+
+#undef RAJAPERF_SIMD_INTRINSICS_PACK
+
+#endif  // RAJAPERF_HAVE_STD_SIMD
+
+
+namespace detail
+{
+
+// call body for each of unroll packs starting at index i
+template < size_t width, size_t unroll >
+struct Unroll
+{
+  template < typename Body >
+  static inline void run(Body& body, Index_type i)
+  {
+    Unroll<width, unroll-1>::run(body, i);
+    body(i + static_cast<Index_type>((unroll-1)*width), unroll-1);
+  }
+};
+///
+template < size_t width >
+struct Unroll<width, 0>
+{
+  template < typename Body >
+  static inline void run(Body&, Index_type) { }
+};
+
+} // closing brace for detail namespace
+
+/*!
+ * \brief Loop over [ibegin, iend) in groups of unroll packs of width
+ *        indices, calling pack_body(i, u) with the first index i of pack u
+ *        in the group; call scalar_body(i) for each remaining index.
+ *
+ * Pack index u lets reductions keep a separate accumulator for each pack
+ * in a group.
+ */
+template < size_t width, size_t unroll, typename PackBody, typename ScalarBody >
+inline void forall(Index_type ibegin, Index_type iend,
+                   PackBody&& pack_body, ScalarBody&& scalar_body)
+{
+  constexpr Index_type step = static_cast<Index_type>(width*unroll);
+  Index_type i = ibegin;
+  for ( ; i + step <= iend; i += step ) {
+    detail::Unroll<width, unroll>::run(pack_body, i);
+  }
+  for ( ; i < iend; ++i ) {
+    scalar_body(i);
+  }
+}
+
+} // closing brace for simd namespace
+
+} // closing brace for rajaperf namespace
+
+//
+#define RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(kernel)                        \
+  void kernel::runSIMDVariant(VariantID vid, size_t tune_idx)                  \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(simd::widths_type{}, [&](auto width) {                             \
+      seq_for(simd::unrolls_type{}, [&](auto unroll) {                         \
+        if (tune_idx == t) {                                                   \
+          runSIMDVariantImpl<decltype(width)::value,                           \
+                             decltype(unroll)::value>(vid);                    \
+        }                                                                      \
+        t += 1;                                                                \
+      });                                                                      \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::setSIMDTuningDefinitions(VariantID vid)                         \
+  {                                                                            \
+    seq_for(simd::widths_type{}, [&](auto width) {                             \
+      seq_for(simd::unrolls_type{}, [&](auto unroll) {                         \
+        addVariantTuningName(vid, "width_"+std::to_string(width)+              \
+                                  "_unroll_"+std::to_string(unroll));          \
+      });                                                                      \
+    });                                                                        \
+  }
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "StatUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rajaperf
+{
+
+namespace
+{
+
+/*
+ * Return two-sided 95% critical value of Student's t-distribution for
+ * given degrees of freedom (at least 1).
+ */
+double getTCritical95(size_t dof)
+{
+  // Critical values for 1 to 30 degrees of freedom; normal approximation
+  // beyond that.
+  static const double t_crit[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+     2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+     2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+  const size_t num_t_crit = sizeof(t_crit) / sizeof(t_crit[0]);
+
+  dof = std::max(dof, static_cast<size_t>(1));
+  return ( dof <= num_t_crit ) ? t_crit[dof-1] : 1.960;
+}
+
+}  // closing brace for anonymous namespace
+
+/*
+ * Return arithmetic mean of values.
+ */
+double calcMean(const std::vector<double>& vals)
+{
+  if ( vals.empty() ) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (double val : vals) {
+    sum += val;
+  }
+  return sum / vals.size();
+}
+
+/*
+ * Return sample standard deviation of values.
+ */
+double calcStdDev(const std::vector<double>& vals)
+{
+  if ( vals.size() < 2 ) {
+    return 0.0;
+  }
+  double mean = calcMean(vals);
+  double sum2 = 0.0;
+  for (double val : vals) {
+    sum2 += (val - mean) * (val - mean);
+  }
+  return std::sqrt( sum2 / (vals.size() - 1) );
+}
+
+/*
+ * Return half-width of 95% confidence interval of mean of values.
+ */
+double calcConfidenceHalfWidth(const std::vector<double>& vals)
+{
+  if ( vals.size() < 2 ) {
+    return 0.0;
+  }
+
+  double t = getTCritical95(vals.size() - 1);
+
+  return t * calcStdDev(vals) / std::sqrt( static_cast<double>(vals.size()) );
+}
+
+/*
+ * Welch's t-test of difference of means of two samples with unequal
+ * variances, at 95% confidence.
+ */
+bool isSignificantDifference(double mean_a, double stddev_a, size_t n_a,
+                             double mean_b, double stddev_b, size_t n_b)
+{
+  if ( n_a < 2 || n_b < 2 ) {
+    return false;
+  }
+
+  double var_a = stddev_a * stddev_a / n_a;
+  double var_b = stddev_b * stddev_b / n_b;
+  double var = var_a + var_b;
+  if ( var <= 0.0 ) {
+    return mean_a != mean_b;
+  }
+
+  double t = std::abs(mean_a - mean_b) / std::sqrt(var);
+
+  // Welch-Satterthwaite degrees of freedom, rounded down
+  double dof = var * var / ( var_a * var_a / (n_a - 1) +
+                             var_b * var_b / (n_b - 1) );
+
+  return t > getTCritical95( static_cast<size_t>(dof) );
+}
+
+/*
+ * Return percentile of sorted values, interpolating between closest ranks.
+ */
+double calcPercentile(const std::vector<double>& sorted_vals, double pct)
+{
+  if ( sorted_vals.empty() ) {
+    return 0.0;
+  }
+  double rank = std::min(std::max(pct, 0.0), 100.0) / 100.0 *
+                (sorted_vals.size() - 1);
+  size_t lo = static_cast<size_t>( std::floor(rank) );
+  size_t hi = std::min(lo + 1, sorted_vals.size() - 1);
+  double frac = rank - lo;
+  return sorted_vals[lo] + frac * (sorted_vals[hi] - sorted_vals[lo]);
+}
+
+/*
+ * Compute equal width histogram of values.
+ */
+void calcHistogram(const std::vector<double>& vals, size_t nbins,
+                   std::vector<double>& bin_lo,
+                   std::vector<double>& bin_hi,
+                   std::vector<size_t>& counts)
+{
+  bin_lo.clear();
+  bin_hi.clear();
+  counts.clear();
+
+  if ( vals.empty() || nbins == 0 ) {
+    return;
+  }
+
+  auto minmax = std::minmax_element(vals.begin(), vals.end());
+  double vmin = *minmax.first;
+  double vmax = *minmax.second;
+  double width = (vmax - vmin) / nbins;
+
+  bin_lo.resize(nbins);
+  bin_hi.resize(nbins);
+  counts.resize(nbins, 0);
+  for (size_t ib = 0; ib < nbins; ++ib) {
+    bin_lo[ib] = vmin + ib * width;
+    bin_hi[ib] = vmin + (ib + 1) * width;
+  }
+  bin_hi[nbins-1] = vmax;
+
+  for (double val : vals) {
+    size_t ib = nbins - 1;
+    if ( width > 0.0 ) {
+      ib = std::min( static_cast<size_t>( (val - vmin) / width ), nbins - 1 );
+    }
+    counts[ib]++;
+  }
+}
+
+}  // closing brace for rajaperf namespace
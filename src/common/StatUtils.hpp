@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Utility methods for computing statistics of timing samples.
+///
+
+#ifndef RAJAPerf_StatUtils_HPP
+#define RAJAPerf_StatUtils_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Return arithmetic mean of values; zero if there are none.
+ */
+double calcMean(const std::vector<double>& vals);
+
+/*!
+ * \brief Return sample standard deviation of values (n-1 normalization);
+ *        zero if there are fewer than two values.
+ */
+double calcStdDev(const std::vector<double>& vals);
+
+/*!
+ * \brief Return half-width of 95% confidence interval of mean of values,
+ *        using Student's t-distribution; zero if there are fewer than
+ *        two values.
+ */
+double calcConfidenceHalfWidth(const std::vector<double>& vals);
+
+/*!
+ * \brief Return true if means of two samples, given by mean, sample standard
+ *        deviation, and number of values, differ at 95% confidence.
+ *
+ * Welch's t-test is used, so samples may have different variances; false
+ * if either sample has fewer than two values.
+ */
+bool isSignificantDifference(double mean_a, double stddev_a, size_t n_a,
+                             double mean_b, double stddev_b, size_t n_b);
+
+/*!
+ * \brief Return given percentile (in [0, 100]) of values in a sorted vector.
+ *
+ * Linear interpolation is used between closest ranks.
+ */
+double calcPercentile(const std::vector<double>& sorted_vals, double pct);
+
+/*!
+ * \brief Compute histogram of values with given number of equal width bins
+ *        spanning [min value, max value].
+ *
+ * On return, bin_lo holds lower bin edges, bin_hi upper bin edges, and
+ * counts the number of values in each bin.
+ */
+void calcHistogram(const std::vector<double>& vals, size_t nbins,
+                   std::vector<double>& bin_lo,
+                   std::vector<double>& bin_hi,
+                   std::vector<size_t>& counts);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
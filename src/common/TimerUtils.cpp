@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TimerUtils.hpp"
+
+#include "RAJAPerfSuite.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+#if defined(RAJAPERF_HAVE_TSC)
+#include <cpuid.h>
+#endif
+
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+#include <mpi.h>
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+static RunParams::TimerBackend timer_backend = RunParams::TimerBackend::RAJATimer;
+static double tsc_seconds_per_tick = 0.0;
+static double timer_resolution = 0.0;
+static double timer_overhead = 0.0;
+
+//
+// Time (sec.) over which TSC frequency is measured, and max relative
+// difference of frequencies measured over two such intervals.
+//
+static const double tsc_calib_time = 0.05;
+static const double tsc_calib_tol = 1.0e-3;
+
+//
+// Number of empty start/stop pairs timed to measure timer overhead.
+//
+static const int overhead_num_trials = 1000;
+
+/*
+ * Return true if TSC ticks at a constant rate in all power states and
+ * is synchronized across CPUs; otherwise set reason it is not.
+ */
+static bool isTSCTrustworthy(std::string& reason)
+{
+#if defined(RAJAPERF_HAVE_TSC)
+  // invariant TSC bit of extended power management leaf
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if ( !__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) ||
+       !(edx & (1u << 8)) ) {
+    reason = "CPU has no invariant TSC";
+    return false;
+  }
+
+#if defined(__linux__)
+  // Linux stops using TSC as clock source if it finds TSCs of CPUs are
+  // not synchronized
+  std::ifstream clocksource(
+      "/sys/devices/system/clocksource/clocksource0/current_clocksource");
+  std::string source;
+  if ( (clocksource >> source) && source != "tsc" ) {
+    reason = "kernel clock source is " + source + ", not tsc";
+    return false;
+  }
+#endif
+
+  return true;
+#else
+  reason = "TSC is not available on this architecture";
+  return false;
+#endif
+}
+
+/*
+ * Return seconds per TSC tick measured against steady clock.
+ */
+static double measureTSCSecondsPerTick()
+{
+  using clock = std::chrono::steady_clock;
+
+  clock::time_point clock_start = clock::now();
+  uint64_t tsc_start = readTSCStart();
+
+  double secs = 0.0;
+  uint64_t tsc_stop = tsc_start;
+  do {
+    tsc_stop = readTSCStop();
+    secs = std::chrono::duration<double>(clock::now() - clock_start).count();
+  } while ( secs < tsc_calib_time );
+
+  return ( tsc_stop > tsc_start ) ? secs / (tsc_stop - tsc_start) : 0.0;
+}
+
+RunParams::TimerBackend calibrateTimer(RunParams::TimerBackend backend)
+{
+  timer_backend = RunParams::TimerBackend::RAJATimer;
+  tsc_seconds_per_tick = 0.0;
+  timer_overhead = 0.0;
+
+  if ( backend == RunParams::TimerBackend::TSCTimer ) {
+    std::string reason;
+    if ( isTSCTrustworthy(reason) ) {
+      double secs_per_tick = measureTSCSecondsPerTick();
+      double secs_per_tick_check = measureTSCSecondsPerTick();
+      if ( secs_per_tick > 0.0 &&
+           std::abs(secs_per_tick_check - secs_per_tick) <=
+             tsc_calib_tol * secs_per_tick ) {
+        timer_backend = RunParams::TimerBackend::TSCTimer;
+        tsc_seconds_per_tick = secs_per_tick;
+      } else {
+        reason = "TSC rate is not steady";
+      }
+    }
+    if ( timer_backend != RunParams::TimerBackend::TSCTimer ) {
+      getCout() << "\n Can't use TSC timer (" << reason << ");"
+                << " using RAJA timer" << std::endl;
+    }
+  }
+
+  //
+  // Overhead is the shortest interval measured with nothing timed but
+  // what KernelBase::stopTimer does before the timer is stopped (there is
+  // no device synchronization here). Resolution is the shortest nonzero
+  // interval, or a TSC tick.
+  //
+  double min_interval = std::numeric_limits<double>::max();
+  double min_nonzero_interval = std::numeric_limits<double>::max();
+  for (int trial = 0; trial < overhead_num_trials; ++trial) {
+    PerfTimer timer;
+    timer.start();
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    timer.stop();
+    double interval = timer.elapsed();
+    min_interval = std::min(min_interval, interval);
+    if ( interval > 0.0 ) {
+      min_nonzero_interval = std::min(min_nonzero_interval, interval);
+    }
+  }
+
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  // subtract no more than the smallest overhead of any rank
+  double min_interval_local = min_interval;
+  MPI_Allreduce(&min_interval_local, &min_interval, 1, MPI_DOUBLE, MPI_MIN,
+                MPI_COMM_WORLD);
+#endif
+
+  timer_overhead = min_interval;
+  if ( timer_backend == RunParams::TimerBackend::TSCTimer ) {
+    timer_resolution = tsc_seconds_per_tick;
+  } else {
+    timer_resolution = ( min_nonzero_interval < std::numeric_limits<double>::max() ) ?
+                       min_nonzero_interval : 0.0;
+  }
+
+  return timer_backend;
+}
+
+RunParams::TimerBackend getTimerBackend()
+{
+  return timer_backend;
+}
+
+double getTimerResolution()
+{
+  return timer_resolution;
+}
+
+double getTimerOverhead()
+{
+  return timer_overhead;
+}
+
+double getTSCSecondsPerTick()
+{
+  return tsc_seconds_per_tick;
+}
+
+}  // closing brace for detail namespace
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Timer used to time kernel reps, with selectable backend and calibrated
+/// overhead subtraction.
+///
+
+#ifndef RAJAPerf_TimerUtils_HPP
+#define RAJAPerf_TimerUtils_HPP
+
+#include "RunParams.hpp"
+
+#include "RAJA/util/Timer.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RAJAPERF_HAVE_TSC
+#endif
+
+namespace rajaperf
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Calibrate timer with given backend: check TSC can be trusted and
+ *        measure its frequency (TSC backend), and measure resolution and
+ *        overhead of a start/stop pair, which timers then subtract.
+ *
+ * Falls back to the RAJA timer backend, with a message, if the TSC can't
+ * be trusted. Return backend used.
+ */
+RunParams::TimerBackend calibrateTimer(RunParams::TimerBackend backend);
+
+/*!
+ * \brief Return timer backend in use.
+ */
+RunParams::TimerBackend getTimerBackend();
+
+/*!
+ * \brief Return timer resolution (sec.).
+ */
+double getTimerResolution();
+
+/*!
+ * \brief Return time (sec.) measured by a start/stop pair with nothing
+ *        between them, subtracted from each timed interval.
+ */
+double getTimerOverhead();
+
+/*!
+ * \brief Return seconds per TSC tick; zero if TSC is not calibrated.
+ */
+double getTSCSecondsPerTick();
+
+#if defined(RAJAPERF_HAVE_TSC)
+//
+// Fences keep timed instructions from moving before the start read or
+// after the stop read.
+//
+inline uint64_t readTSCStart()
+{
+  _mm_lfence();
+  uint64_t tsc = __rdtsc();
+  _mm_lfence();
+  return tsc;
+}
+
+inline uint64_t readTSCStop()
+{
+  unsigned int aux;
+  uint64_t tsc = __rdtscp(&aux);
+  _mm_lfence();
+  return tsc;
+}
+#else
+inline uint64_t readTSCStart() { return 0; }
+inline uint64_t readTSCStop() { return 0; }
+#endif
+
+}  // closing brace for detail namespace
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Accumulating interval timer using the calibrated timer backend.
+ *
+ * Timer overhead is subtracted from each interval, which is clamped at zero.
+ *
+ *******************************************************************************
+ */
+class PerfTimer
+{
+public:
+  using ElapsedType = RAJA::Timer::ElapsedType;
+
+  void start()
+  {
+    use_tsc = ( detail::getTimerBackend() == RunParams::TimerBackend::TSCTimer );
+    if ( use_tsc ) {
+      tsc_start = detail::readTSCStart();
+    } else {
+      raja_timer.start();
+    }
+  }
+
+  void stop()
+  {
+    ElapsedType interval = 0.0;
+    if ( use_tsc ) {
+      uint64_t tsc_stop = detail::readTSCStop();
+      interval = (tsc_stop - tsc_start) * detail::getTSCSecondsPerTick();
+    } else {
+      ElapsedType raja_start = raja_timer.elapsed();
+      raja_timer.stop();
+      interval = raja_timer.elapsed() - raja_start;
+    }
+    elapsed_time += std::max(interval - detail::getTimerOverhead(),
+                             static_cast<ElapsedType>(0.0));
+  }
+
+  ElapsedType elapsed() const { return elapsed_time; }
+
+  void reset()
+  {
+    raja_timer.reset();
+    elapsed_time = 0.0;
+  }
+
+private:
+  RAJA::Timer raja_timer;
+  bool use_tsc = false;
+  uint64_t tsc_start = 0;
+  ElapsedType elapsed_time = 0.0;
+};
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
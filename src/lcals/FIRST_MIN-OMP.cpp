@@ -18,7 +18,8 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void FIRST_MIN::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -41,10 +42,11 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         FIRST_MIN_MINLOC_INIT;
 
-        #pragma omp parallel for reduction(minloc:mymin)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          FIRST_MIN_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(minloc:mymin),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            FIRST_MIN_BODY;
+          }
+        )
 
         m_minloc = mymin.loc;
 
@@ -69,13 +71,14 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
         FIRST_MIN_MINLOC_INIT;
 
-        #pragma omp parallel for reduction(minloc:mymin)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          if ( firstmin_base_lam(i) < mymin.val ) {
-            mymin.val = x[i];
-            mymin.loc = i;
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(minloc:mymin),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            if ( firstmin_base_lam(i) < mymin.val ) {
+              mymin.val = x[i];
+              mymin.loc = i;
+            }
           }
-        }
+        )
 
         m_minloc = mymin.loc;
 
@@ -93,7 +96,7 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         RAJA::ReduceMinLoc<RAJA::omp_reduce, Real_type, Index_type> loc(
                                                         m_xmin_init, m_initloc);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           FIRST_MIN_BODY_RAJA;
         });
@@ -117,5 +120,23 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
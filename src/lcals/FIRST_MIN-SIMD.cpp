@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "FIRST_MIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+template < size_t width, size_t unroll >
+void FIRST_MIN::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    //
+    // Each pack lane keeps the first min of the indices it sees, with its
+    // index held as a Real_type (exact below 2^53). Lane mins and the min
+    // of the remaining indices are combined taking the lower index on ties,
+    // so the first min is found.
+    //
+    const pack vstep(static_cast<Real_type>(width*unroll));
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      FIRST_MIN_MINLOC_INIT;
+
+      pack vmin[unroll];
+      pack vloc[unroll];
+      pack vidx[unroll];
+      for (size_t u = 0; u < unroll; ++u) {
+        vmin[u] = pack(mymin.val);
+        vloc[u] = pack(static_cast<Real_type>(mymin.loc));
+        vidx[u] = pack::iota(
+                    static_cast<Real_type>(ibegin + static_cast<Index_type>(u*width)));
+      }
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t u) {
+          const pack vx = pack::load(&x[i]);
+          const auto is_less = ( vx < vmin[u] );
+          vmin[u] = select(is_less, vx, vmin[u]);
+          vloc[u] = select(is_less, vidx[u], vloc[u]);
+          vidx[u] = vidx[u] + vstep;
+        },
+        [&](Index_type i) {
+          FIRST_MIN_BODY;
+        });
+
+      for (size_t u = 0; u < unroll; ++u) {
+        for (size_t l = 0; l < width; ++l) {
+          const Real_type val = vmin[u][l];
+          const Index_type loc = static_cast<Index_type>(vloc[u][l]);
+          if ( val < mymin.val || ( val == mymin.val && loc < mymin.loc ) ) {
+            mymin.val = val;
+            mymin.loc = loc;
+          }
+        }
+      }
+
+      m_minloc = mymin.loc;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  FIRST_MIN : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(FIRST_MIN)
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
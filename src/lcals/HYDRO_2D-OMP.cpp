@@ -178,5 +178,12 @@ void HYDRO_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+void HYDRO_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  // loops run in one parallel region with static schedules and no waits
+  // between them, so they can't take schedule tunings
+  addVariantTuningName(vid, getDefaultTuningName());
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
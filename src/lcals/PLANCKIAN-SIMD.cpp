@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "PLANCKIAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+template < size_t width, size_t unroll >
+void PLANCKIAN::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PLANCKIAN_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    const pack vone(1.0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t) {
+          const pack vy = pack::load(&u[i]) / pack::load(&v[i]);
+          vy.store(&y[i]);
+          ( pack::load(&x[i]) / ( exp(vy) - vone ) ).store(&w[i]);
+        },
+        [&](Index_type i) {
+          PLANCKIAN_BODY;
+        });
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PLANCKIAN : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(PLANCKIAN)
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
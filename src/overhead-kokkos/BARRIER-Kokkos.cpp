@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BARRIER.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace overhead {
+
+void BARRIER::runKokkosVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  BARRIER_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    // Kokkos range kernels can't synchronize inside; each phase is a
+    // kernel and a fence takes the place of the barrier
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      for (Index_type p = 0; p < num_phases; ++p) {
+        Kokkos::parallel_for(
+            "BARRIER-Kokkos Kokkos_Lambda",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+            KOKKOS_LAMBDA(Index_type i) { x_view[i] += val; });
+        Kokkos::fence();
+      }
+    }
+
+    stopTimer();
+
+    break;
+  }
+  default: {
+    std::cout << "\n  BARRIER : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(x, x_view, iend);
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
+#endif
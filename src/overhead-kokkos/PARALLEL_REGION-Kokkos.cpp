@@ -0,0 +1,65 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PARALLEL_REGION.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace overhead {
+
+void PARALLEL_REGION::runKokkosVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PARALLEL_REGION_DATA_SETUP;
+
+  auto x_view = getViewFromPointer(x, iend);
+
+  // Kokkos has no bare parallel region; launch one work item per unit of
+  // concurrency, each writing a contiguous chunk, as threads of a region do
+  const Index_type nchunks = Kokkos::DefaultExecutionSpace().concurrency();
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+      Kokkos::parallel_for(
+          "PARALLEL_REGION-Kokkos Kokkos_Lambda",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, nchunks),
+          KOKKOS_LAMBDA(Index_type ichunk) {
+            const Index_type chunk_begin = ibegin + ((iend - ibegin) * ichunk) / nchunks;
+            const Index_type chunk_end = ibegin + ((iend - ibegin) * (ichunk+1)) / nchunks;
+            for (Index_type i = chunk_begin; i < chunk_end; ++i) {
+              x_view[i] = val;
+            }
+          });
+      Kokkos::fence();
+    }
+
+    stopTimer();
+
+    break;
+  }
+  default: {
+    std::cout << "\n  PARALLEL_REGION : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(x, x_view, iend);
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
+#endif
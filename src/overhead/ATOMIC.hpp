@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// ATOMIC kernel reference implementation:
+///
+/// *sum = sum_init;
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   atomic *sum += x[i] ;
+/// }
+///
+/// Every iteration updates the same location, so parallel variants measure
+/// the cost of atomic updates under the highest contention.
+///
+
+#ifndef RAJAPerf_Overhead_ATOMIC_HPP
+#define RAJAPerf_Overhead_ATOMIC_HPP
+
+#define ATOMIC_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr sum = m_sum;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class ATOMIC : public KernelBase
+{
+public:
+
+  ATOMIC(const RunParams& params);
+
+  ~ATOMIC();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_sum;
+  Real_type m_sum_init;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BARRIER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+
+void BARRIER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  BARRIER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type p = 0; p < num_phases; ++p ) {
+            #pragma omp for schedule(static) nowait
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              BARRIER_BODY;
+            }
+            #pragma omp barrier
+          }
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          // RAJA has no standalone barrier; each loop ends with one
+          for (Index_type p = 0; p < num_phases; ++p ) {
+            RAJA::forall<RAJA::omp_for_static_exec< >>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              BARRIER_BODY;
+            });
+          }
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BARRIER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void BARRIER::setOpenMPTuningDefinitions(VariantID vid)
+{
+  // the loop uses a fixed schedule(static) work-share, which is part of what
+  // this kernel measures, so schedule tunings are omitted
+  addVariantTuningName(vid, getDefaultTuningName());
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BARRIER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace overhead
+{
+
+
+BARRIER::BARRIER(const RunParams& params)
+  : KernelBase(rajaperf::Overhead_BARRIER, params)
+{
+  setDefaultProblemSize(1000);
+  setDefaultReps(10000);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( s_num_phases * getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  s_num_phases * getActualProblemSize() );
+  setFLOPsPerRep(s_num_phases * getActualProblemSize());
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Kokkos_Lambda );
+}
+
+BARRIER::~BARRIER()
+{
+}
+
+void BARRIER::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitDataConst(m_x, getActualProblemSize(), 0.0, vid);
+  m_val = 1.0e-6;
+}
+
+void BARRIER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_x, getActualProblemSize());
+}
+
+void BARRIER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x, vid);
+}
+
+} // end namespace overhead
+} // end namespace rajaperf
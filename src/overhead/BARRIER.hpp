@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BARRIER kernel reference implementation:
+///
+/// parallel region {
+///   for (Index_type p = 0; p < num_phases; ++p ) {
+///     for (Index_type i = ibegin; i < iend; ++i ) {  // split among threads
+///       x[i] += val ;
+///     }
+///     barrier ;
+///   }
+/// }
+///
+/// Measures barriers among threads of one parallel region, as in codes
+/// that keep a region open over several dependent loops.
+///
+
+#ifndef RAJAPerf_Overhead_BARRIER_HPP
+#define RAJAPerf_Overhead_BARRIER_HPP
+
+#define BARRIER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_type val = m_val; \
+  const Index_type num_phases = s_num_phases;
+
+#define BARRIER_BODY \
+  x[i] += val;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class BARRIER : public KernelBase
+{
+public:
+
+  BARRIER(const RunParams& params);
+
+  ~BARRIER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BARRIER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BARRIER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  BARRIER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+private:
+  static const Index_type s_num_phases = 8;
+
+  Real_ptr m_x;
+  Real_type m_val;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
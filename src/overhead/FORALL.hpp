@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FORALL kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   x[i] = val ;
+/// }
+///
+/// The loop body is trivial, so the time of a parallel variant at small
+/// loop lengths is the cost of launching the loop (fork/join and the
+/// barrier that ends a worksharing loop).
+///
+
+#ifndef RAJAPerf_Overhead_FORALL_HPP
+#define RAJAPerf_Overhead_FORALL_HPP
+
+#define FORALL_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_type val = m_val;
+
+#define FORALL_BODY \
+  x[i] = val;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class FORALL : public KernelBase
+{
+public:
+
+  FORALL(const RunParams& params);
+
+  ~FORALL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FORALL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FORALL : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FORALL : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_type m_val;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
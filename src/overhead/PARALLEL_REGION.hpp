@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PARALLEL_REGION kernel reference implementation:
+///
+/// parallel region {
+///   for (Index_type i = ibegin; i < iend; ++i ) {  // split among threads,
+///     x[i] = val ;                                  // no barrier at end
+///   }
+/// }
+///
+/// Measures fork/join of a parallel region; unlike FORALL, the loop in the
+/// region does not end with a barrier, so only the join synchronizes.
+///
+
+#ifndef RAJAPerf_Overhead_PARALLEL_REGION_HPP
+#define RAJAPerf_Overhead_PARALLEL_REGION_HPP
+
+#define PARALLEL_REGION_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_type val = m_val;
+
+#define PARALLEL_REGION_BODY \
+  x[i] = val;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class PARALLEL_REGION : public KernelBase
+{
+public:
+
+  PARALLEL_REGION(const RunParams& params);
+
+  ~PARALLEL_REGION();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PARALLEL_REGION : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PARALLEL_REGION : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  PARALLEL_REGION : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_type m_val;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
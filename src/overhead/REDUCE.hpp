@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// REDUCE kernel reference implementation:
+///
+/// Real_type sum = sum_init;
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   sum += x[i] ;
+/// }
+///
+/// Measures the cost of combining per-thread partial sums at loop lengths
+/// too small for the loop itself to take much time.
+///
+
+#ifndef RAJAPerf_Overhead_REDUCE_HPP
+#define RAJAPerf_Overhead_REDUCE_HPP
+
+#define REDUCE_DATA_SETUP \
+  Real_ptr x = m_x;
+
+#define REDUCE_BODY \
+  sum += x[i];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace overhead
+{
+
+class REDUCE : public KernelBase
+{
+public:
+
+  REDUCE(const RunParams& params);
+
+  ~REDUCE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  REDUCE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  REDUCE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  REDUCE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_type m_sum_init;
+  Real_type m_sum;
+};
+
+} // end namespace overhead
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -16,6 +16,12 @@
 #define USE_OMP_COLLAPSE
 //#undef USE_OMP_COLLAPSE
 
+#if defined(USE_OMP_COLLAPSE)
+#define POLYBENCH_2MM_OMP_COLLAPSE collapse(2)
+#else
+#define POLYBENCH_2MM_OMP_COLLAPSE
+#endif
+
 #define USE_RAJA_OMP_COLLAPSE
 //#undef USE_RAJA_OMP_COLLAPSE
 
@@ -26,7 +32,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_2MM::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -41,35 +48,29 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
-        #pragma omp parallel for collapse(2)
-#else
-        #pragma omp parallel for
-#endif
-        for (Index_type i = 0; i < ni; i++ ) {
-          for(Index_type j = 0; j < nj; j++) {
-            POLYBENCH_2MM_BODY1;
-            for (Index_type k = 0; k < nk; k++) {
-              POLYBENCH_2MM_BODY2;
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, POLYBENCH_2MM_OMP_COLLAPSE,
+          for (Index_type i = 0; i < ni; i++ ) {
+            for(Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY1;
+              for (Index_type k = 0; k < nk; k++) {
+                POLYBENCH_2MM_BODY2;
+              }
+              POLYBENCH_2MM_BODY3;
             }
-            POLYBENCH_2MM_BODY3;
           }
-        }
-
-#if defined(USE_OMP_COLLAPSE)
-        #pragma omp parallel for collapse(2)
-#else
-        #pragma omp parallel for
-#endif
-        for(Index_type i = 0; i < ni; i++) {
-          for(Index_type l = 0; l < nl; l++) {
-            POLYBENCH_2MM_BODY4;
-            for (Index_type j = 0; j < nj; j++) {
-              POLYBENCH_2MM_BODY5;
+        )
+
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, POLYBENCH_2MM_OMP_COLLAPSE,
+          for(Index_type i = 0; i < ni; i++) {
+            for(Index_type l = 0; l < nl; l++) {
+              POLYBENCH_2MM_BODY4;
+              for (Index_type j = 0; j < nj; j++) {
+                POLYBENCH_2MM_BODY5;
+              }
+              POLYBENCH_2MM_BODY6;
             }
-            POLYBENCH_2MM_BODY6;
           }
-        }
+        )
 
       }
       stopTimer();
@@ -99,35 +100,29 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
-        #pragma omp parallel for collapse(2)
-#else
-        #pragma omp parallel for
-#endif
-        for (Index_type i = 0; i < ni; i++ ) {
-          for(Index_type j = 0; j < nj; j++) {
-            POLYBENCH_2MM_BODY1;
-            for (Index_type k = 0; k < nk; k++) {
-              poly_2mm_base_lam2(i, j, k, dot);
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, POLYBENCH_2MM_OMP_COLLAPSE,
+          for (Index_type i = 0; i < ni; i++ ) {
+            for(Index_type j = 0; j < nj; j++) {
+              POLYBENCH_2MM_BODY1;
+              for (Index_type k = 0; k < nk; k++) {
+                poly_2mm_base_lam2(i, j, k, dot);
+              }
+              poly_2mm_base_lam3(i, j, dot);
             }
-            poly_2mm_base_lam3(i, j, dot);
           }
-        }
-
-#if defined(USE_OMP_COLLAPSE)
-        #pragma omp parallel for collapse(2)
-#else
-        #pragma omp parallel for
-#endif
-        for(Index_type i = 0; i < ni; i++) {
-          for(Index_type l = 0; l < nl; l++) {
-            POLYBENCH_2MM_BODY4;
-            for (Index_type j = 0; j < nj; j++) {
-              poly_2mm_base_lam5(i, l, j, dot);
+        )
+
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, POLYBENCH_2MM_OMP_COLLAPSE,
+          for(Index_type i = 0; i < ni; i++) {
+            for(Index_type l = 0; l < nl; l++) {
+              POLYBENCH_2MM_BODY4;
+              for (Index_type j = 0; j < nj; j++) {
+                poly_2mm_base_lam5(i, l, j, dot);
+              }
+              poly_2mm_base_lam6(i, l, dot);
             }
-            poly_2mm_base_lam6(i, l, dot);
           }
-        }
+        )
 
       }
       stopTimer();
@@ -177,7 +172,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #else // without collapse...
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<0, RAJA::Params<0>>,
               RAJA::statement::For<2, RAJA::loop_exec,
@@ -231,5 +226,23 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_2MM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_ADI::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -36,29 +37,31 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
         for (Index_type t = 1; t <= tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < n-1; ++i) {
-            POLYBENCH_ADI_BODY2;
-            for (Index_type j = 1; j < n-1; ++j) {
-              POLYBENCH_ADI_BODY3;
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY2;
+              for (Index_type j = 1; j < n-1; ++j) {
+                POLYBENCH_ADI_BODY3;
+              }
+              POLYBENCH_ADI_BODY4;
+              for (Index_type k = n-2; k >= 1; --k) {
+                POLYBENCH_ADI_BODY5;
+              }
             }
-            POLYBENCH_ADI_BODY4;
-            for (Index_type k = n-2; k >= 1; --k) {
-              POLYBENCH_ADI_BODY5;
+          )
+
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY6;
+              for (Index_type j = 1; j < n-1; ++j) {
+                POLYBENCH_ADI_BODY7;
+              }
+              POLYBENCH_ADI_BODY8;
+              for (Index_type k = n-2; k >= 1; --k) {
+                POLYBENCH_ADI_BODY9;
+              }
             }
-          }
-
-          #pragma omp parallel for
-          for (Index_type i = 1; i < n-1; ++i) {
-            POLYBENCH_ADI_BODY6;
-            for (Index_type j = 1; j < n-1; ++j) {
-              POLYBENCH_ADI_BODY7;
-            }
-            POLYBENCH_ADI_BODY8;
-            for (Index_type k = n-2; k >= 1; --k) {
-              POLYBENCH_ADI_BODY9;
-            }
-          }
+          )
 
         }  // tstep loop
 
@@ -100,29 +103,31 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
         for (Index_type t = 1; t <= tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < n-1; ++i) {
-            poly_adi_base_lam2(i);
-            for (Index_type j = 1; j < n-1; ++j) {
-              poly_adi_base_lam3(i, j);
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < n-1; ++i) {
+              poly_adi_base_lam2(i);
+              for (Index_type j = 1; j < n-1; ++j) {
+                poly_adi_base_lam3(i, j);
+              }
+              poly_adi_base_lam4(i);
+              for (Index_type k = n-2; k >= 1; --k) {
+                poly_adi_base_lam5(i, k);
+              }
             }
-            poly_adi_base_lam4(i);
-            for (Index_type k = n-2; k >= 1; --k) {
-              poly_adi_base_lam5(i, k);
+          )
+
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < n-1; ++i) {
+              poly_adi_base_lam6(i);
+              for (Index_type j = 1; j < n-1; ++j) {
+                poly_adi_base_lam7(i, j);
+              }
+              poly_adi_base_lam8(i);
+              for (Index_type k = n-2; k >= 1; --k) {
+                poly_adi_base_lam9(i, k);
+              }
             }
-          }
-
-          #pragma omp parallel for
-          for (Index_type i = 1; i < n-1; ++i) {
-            poly_adi_base_lam6(i);
-            for (Index_type j = 1; j < n-1; ++j) {
-              poly_adi_base_lam7(i, j);
-            }
-            poly_adi_base_lam8(i);
-            for (Index_type k = n-2; k >= 1; --k) {
-              poly_adi_base_lam9(i, k);
-            }
-          }
+          )
 
         }  // tstep loop
 
@@ -163,7 +168,7 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::Lambda<0, RAJA::Segs<0>>,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<1, RAJA::Segs<0,1>>
@@ -223,5 +228,23 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_ATAX::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -34,23 +35,25 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY1;
-          for (Index_type j = 0; j < N; ++j ) {
-            POLYBENCH_ATAX_BODY2;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_ATAX_BODY2;
+            }
+            POLYBENCH_ATAX_BODY3;
           }
-          POLYBENCH_ATAX_BODY3;
-        }
+        )
 
-        #pragma omp parallel for
-        for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY4;
-          for (Index_type i = 0; i < N; ++i ) {
-            POLYBENCH_ATAX_BODY5;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY4;
+            for (Index_type i = 0; i < N; ++i ) {
+              POLYBENCH_ATAX_BODY5;
+            }
+            POLYBENCH_ATAX_BODY6;
           }
-          POLYBENCH_ATAX_BODY6;
-        }
+        )
 
       }
       stopTimer();
@@ -80,23 +83,25 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY1;
-          for (Index_type j = 0; j < N; ++j ) {
-            poly_atax_base_lam2(i, j, dot);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              poly_atax_base_lam2(i, j, dot);
+            }
+            poly_atax_base_lam3(i, dot);
           }
-          poly_atax_base_lam3(i, dot);
-        }
+        )
 
-        #pragma omp parallel for
-        for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY4;
-          for (Index_type i = 0; i < N; ++i ) {
-            poly_atax_base_lam5(i, j, dot);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_ATAX_BODY4;
+            for (Index_type i = 0; i < N; ++i ) {
+              poly_atax_base_lam5(i, j, dot);
+            }
+            poly_atax_base_lam6(j, dot);
           }
-          poly_atax_base_lam6(j, dot);
-        }
+        )
 
       }
       stopTimer();
@@ -128,7 +133,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
                              };
       using EXEC_POL1 =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::Lambda<0, RAJA::Segs<0>, RAJA::Params<0>>,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<1, RAJA::Segs<0,1>, RAJA::Params<0>>
@@ -139,7 +144,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
       using EXEC_POL2 =
         RAJA::KernelPolicy<
-          RAJA::statement::For<1, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<1, OMP_EXEC_POL,
             RAJA::statement::Lambda<0, RAJA::Segs<1>, RAJA::Params<0>>,
             RAJA::statement::For<0, RAJA::loop_exec,
               RAJA::statement::Lambda<1, RAJA::Segs<0,1>, RAJA::Params<0>>
@@ -191,5 +196,23 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
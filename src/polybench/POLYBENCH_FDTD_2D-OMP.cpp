@@ -18,7 +18,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_FDTD_2D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -35,28 +36,32 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
         for (t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type j = 0; j < ny; j++) {
-            POLYBENCH_FDTD_2D_BODY1;
-          }
-          #pragma omp parallel for
-          for (Index_type i = 1; i < nx; i++) {
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
             for (Index_type j = 0; j < ny; j++) {
-              POLYBENCH_FDTD_2D_BODY2;
+              POLYBENCH_FDTD_2D_BODY1;
             }
-          }
-          #pragma omp parallel for
-          for (Index_type i = 0; i < nx; i++) {
-            for (Index_type j = 1; j < ny; j++) {
-              POLYBENCH_FDTD_2D_BODY3;
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < nx; i++) {
+              for (Index_type j = 0; j < ny; j++) {
+                POLYBENCH_FDTD_2D_BODY2;
+              }
             }
-          }
-          #pragma omp parallel for
-          for (Index_type i = 0; i < nx - 1; i++) {
-            for (Index_type j = 0; j < ny - 1; j++) {
-              POLYBENCH_FDTD_2D_BODY4;
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 0; i < nx; i++) {
+              for (Index_type j = 1; j < ny; j++) {
+                POLYBENCH_FDTD_2D_BODY3;
+              }
             }
-          }
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 0; i < nx - 1; i++) {
+              for (Index_type j = 0; j < ny - 1; j++) {
+                POLYBENCH_FDTD_2D_BODY4;
+              }
+            }
+          )
 
         }  // tstep loop
 
@@ -91,28 +96,32 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
         for (t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type j = 0; j < ny; j++) {
-            poly_fdtd2d_base_lam1(j);
-          }
-          #pragma omp parallel for
-          for (Index_type i = 1; i < nx; i++) {
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
             for (Index_type j = 0; j < ny; j++) {
-              poly_fdtd2d_base_lam2(i, j);
+              poly_fdtd2d_base_lam1(j);
+            }
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < nx; i++) {
+              for (Index_type j = 0; j < ny; j++) {
+                poly_fdtd2d_base_lam2(i, j);
+              }
             }
-          }
-          #pragma omp parallel for
-          for (Index_type i = 0; i < nx; i++) {
-            for (Index_type j = 1; j < ny; j++) {
-              poly_fdtd2d_base_lam3(i, j);
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 0; i < nx; i++) {
+              for (Index_type j = 1; j < ny; j++) {
+                poly_fdtd2d_base_lam3(i, j);
+              }
             }
-          }
-          #pragma omp parallel for
-          for (Index_type i = 0; i < nx - 1; i++) {
-            for (Index_type j = 0; j < ny - 1; j++) {
-              poly_fdtd2d_base_lam4(i, j);
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 0; i < nx - 1; i++) {
+              for (Index_type j = 0; j < ny - 1; j++) {
+                poly_fdtd2d_base_lam4(i, j);
+              }
             }
-          }
+          )
 
         }  // tstep loop
 
@@ -144,11 +153,11 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
                                 POLYBENCH_FDTD_2D_BODY4_RAJA;
                               };
 
-      using EXEC_POL1 = RAJA::omp_parallel_for_exec;
+      using EXEC_POL1 = OMP_EXEC_POL;
 
       using EXEC_POL234 =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<0>
             >
@@ -201,5 +210,23 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
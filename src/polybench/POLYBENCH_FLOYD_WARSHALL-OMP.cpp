@@ -15,6 +15,12 @@
 //#define USE_OMP_COLLAPSE
 #undef USE_OMP_COLLAPSE
 
+#if defined(USE_OMP_COLLAPSE)
+#define POLYBENCH_FLOYD_WARSHALL_OMP_COLLAPSE collapse(2)
+#else
+#define POLYBENCH_FLOYD_WARSHALL_OMP_COLLAPSE
+#endif
+
 //#define USE_RAJA_OMP_COLLAPSE
 #undef USE_RAJA_OMP_COLLAPSE
 
@@ -24,7 +30,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,16 +47,13 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type k = 0; k < N; ++k) {
-#if defined(USE_OMP_COLLAPSE)
-          #pragma omp parallel for collapse(2)
-#else
-          #pragma omp parallel for
-#endif
-          for (Index_type i = 0; i < N; ++i) {
-            for (Index_type j = 0; j < N; ++j) {
-              POLYBENCH_FLOYD_WARSHALL_BODY;
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, POLYBENCH_FLOYD_WARSHALL_OMP_COLLAPSE,
+            for (Index_type i = 0; i < N; ++i) {
+              for (Index_type j = 0; j < N; ++j) {
+                POLYBENCH_FLOYD_WARSHALL_BODY;
+              }
             }
-          }
+          )
         }
 
       }
@@ -69,16 +73,13 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type k = 0; k < N; ++k) {
-#if defined(USE_OMP_COLLAPSE)
-          #pragma omp parallel for collapse(2)
-#else
-          #pragma omp parallel for
-#endif
-          for (Index_type i = 0; i < N; ++i) {
-            for (Index_type j = 0; j < N; ++j) {
-              poly_floydwarshall_base_lam(k, i, j);
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, POLYBENCH_FLOYD_WARSHALL_OMP_COLLAPSE,
+            for (Index_type i = 0; i < N; ++i) {
+              for (Index_type j = 0; j < N; ++j) {
+                poly_floydwarshall_base_lam(k, i, j);
+              }
             }
-          }
+          )
         }
 
       }
@@ -110,7 +111,7 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
       using EXEC_POL =
         RAJA::KernelPolicy<
           RAJA::statement::For<0, RAJA::loop_exec,
-            RAJA::statement::For<1, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, OMP_EXEC_POL,
               RAJA::statement::For<2, RAJA::loop_exec,
                 RAJA::statement::Lambda<0>
               >
@@ -145,5 +146,23 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t RAJAPERF_U
 #endif
 }
 
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
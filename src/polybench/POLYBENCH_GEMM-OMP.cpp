@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_GEMM::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -34,17 +35,18 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for collapse(2)
-        for (Index_type i = 0; i < ni; ++i ) {
-          for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
-            POLYBENCH_GEMM_BODY2;
-            for (Index_type k = 0; k < nk; ++k ) {
-              POLYBENCH_GEMM_BODY3;
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, collapse(2),
+          for (Index_type i = 0; i < ni; ++i ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              POLYBENCH_GEMM_BODY1;
+              POLYBENCH_GEMM_BODY2;
+              for (Index_type k = 0; k < nk; ++k ) {
+                POLYBENCH_GEMM_BODY3;
+              }
+              POLYBENCH_GEMM_BODY4;
             }
-            POLYBENCH_GEMM_BODY4;
           }
-        }
+        )
 
       }
       stopTimer();
@@ -69,17 +71,18 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for collapse(2)
-        for (Index_type i = 0; i < ni; ++i ) {
-          for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
-            poly_gemm_base_lam2(i, j);
-            for (Index_type k = 0; k < nk; ++k ) {
-              poly_gemm_base_lam3(i, j, k, dot);
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, collapse(2),
+          for (Index_type i = 0; i < ni; ++i ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              POLYBENCH_GEMM_BODY1;
+              poly_gemm_base_lam2(i, j);
+              for (Index_type k = 0; k < nk; ++k ) {
+                poly_gemm_base_lam3(i, j, k, dot);
+              }
+              poly_gemm_base_lam4(i, j, dot);
             }
-            poly_gemm_base_lam4(i, j, dot);
           }
-        }
+        )
 
       }
       stopTimer();
@@ -153,5 +156,23 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
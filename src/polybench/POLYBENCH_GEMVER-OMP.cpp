@@ -20,7 +20,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_GEMVER::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -35,35 +36,39 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          for (Index_type j = 0; j < n; j++) {
-            POLYBENCH_GEMVER_BODY1;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMVER_BODY1;
+            }
           }
-        }
+        )
+
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY2;
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMVER_BODY3;
+            }
+            POLYBENCH_GEMVER_BODY4;
+          }
+        )
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY2;
-          for (Index_type j = 0; j < n; j++) {
-            POLYBENCH_GEMVER_BODY3;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY5;
           }
-          POLYBENCH_GEMVER_BODY4;
-        }
-
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY5;
-        }
-
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY6;
-          for (Index_type j = 0; j < n; j++) {
-            POLYBENCH_GEMVER_BODY7;
+        )
+
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY6;
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMVER_BODY7;
+            }
+            POLYBENCH_GEMVER_BODY8;
           }
-          POLYBENCH_GEMVER_BODY8;
-        }
+        )
 
       }
       stopTimer();
@@ -97,35 +102,39 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          for (Index_type j = 0; j < n; j++) {
-            poly_gemver_base_lam1(i, j);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            for (Index_type j = 0; j < n; j++) {
+              poly_gemver_base_lam1(i, j);
+            }
+          }
+        )
+
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY2;
+            for (Index_type j = 0; j < n; j++) {
+              poly_gemver_base_lam3(i, j, dot);
+            }
+            poly_gemver_base_lam4(i, dot);
           }
-        }
+        )
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY2;
-          for (Index_type j = 0; j < n; j++) {
-            poly_gemver_base_lam3(i, j, dot);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            poly_gemver_base_lam5(i);
           }
-          poly_gemver_base_lam4(i, dot);
-        }
-
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          poly_gemver_base_lam5(i);
-        }
-
-        #pragma omp parallel for
-        for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY6;
-          for (Index_type j = 0; j < n; j++) {
-            poly_gemver_base_lam7(i, j, dot);
+        )
+
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < n; i++ ) {
+            POLYBENCH_GEMVER_BODY6;
+            for (Index_type j = 0; j < n; j++) {
+              poly_gemver_base_lam7(i, j, dot);
+            }
+            poly_gemver_base_lam8(i, dot);
           }
-          poly_gemver_base_lam8(i, dot);
-        }
+        )
 
       }
       stopTimer();
@@ -164,7 +173,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
       using EXEC_POL1 =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<0, RAJA::Segs<0,1>>
             >
@@ -173,7 +182,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
       using EXEC_POL24 =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::Lambda<0, RAJA::Segs<0>, RAJA::Params<0>>,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<1, RAJA::Segs<0,1>, RAJA::Params<0>>
@@ -234,5 +243,23 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 #endif
 }
 
+void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_GESUMMV::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -34,14 +35,15 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_GESUMMV_BODY1;
-          for (Index_type j = 0; j < N; ++j ) {
-            POLYBENCH_GESUMMV_BODY2;
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_GESUMMV_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_GESUMMV_BODY2;
+            }
+            POLYBENCH_GESUMMV_BODY3;
           }
-          POLYBENCH_GESUMMV_BODY3;
-        }
+        )
 
       }
       stopTimer();
@@ -63,14 +65,15 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_GESUMMV_BODY1;
-          for (Index_type j = 0; j < N; ++j ) {
-            poly_gesummv_base_lam2(i, j, tmpdot, ydot);
+        RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_GESUMMV_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              poly_gesummv_base_lam2(i, j, tmpdot, ydot);
+            }
+            poly_gesummv_base_lam3(i, tmpdot, ydot);
           }
-          poly_gesummv_base_lam3(i, tmpdot, ydot);
-        }
+        )
 
       }
       stopTimer();
@@ -96,7 +99,7 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,   // i
+          RAJA::statement::For<0, OMP_EXEC_POL,   // i
             RAJA::statement::Lambda<0, RAJA::Params<0,1>>,
             RAJA::statement::For<1, RAJA::loop_exec,             // j
               RAJA::statement::Lambda<1, RAJA::Segs<0, 1>, RAJA::Params<0,1>>
@@ -136,5 +139,23 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
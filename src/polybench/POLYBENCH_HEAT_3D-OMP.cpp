@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_HEAT_3D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -36,23 +37,25 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for collapse(2)
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              for (Index_type k = 1; k < N-1; ++k ) {
-                POLYBENCH_HEAT_3D_BODY1;
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, collapse(2),
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                for (Index_type k = 1; k < N-1; ++k ) {
+                  POLYBENCH_HEAT_3D_BODY1;
+                }
               }
             }
-          }
-
-          #pragma omp parallel for collapse(2)
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              for (Index_type k = 1; k < N-1; ++k ) {
-                POLYBENCH_HEAT_3D_BODY2;
+          )
+
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, collapse(2),
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                for (Index_type k = 1; k < N-1; ++k ) {
+                  POLYBENCH_HEAT_3D_BODY2;
+                }
               }
             }
-          }
+          )
 
         }
 
@@ -80,23 +83,25 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for collapse(2)
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              for (Index_type k = 1; k < N-1; ++k ) {
-                poly_heat3d_base_lam1(i, j, k);
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, collapse(2),
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                for (Index_type k = 1; k < N-1; ++k ) {
+                  poly_heat3d_base_lam1(i, j, k);
+                }
               }
             }
-          }
-
-          #pragma omp parallel for collapse(2)
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              for (Index_type k = 1; k < N-1; ++k ) {
-                poly_heat3d_base_lam2(i, j, k);
+          )
+
+          RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, collapse(2),
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                for (Index_type k = 1; k < N-1; ++k ) {
+                  poly_heat3d_base_lam2(i, j, k);
+                }
               }
             }
-          }
+          )
 
         }
 
@@ -164,5 +169,23 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_JACOBI_1D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -43,14 +44,16 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            POLYBENCH_JACOBI_1D_BODY1;
-          }
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            POLYBENCH_JACOBI_1D_BODY2;
-          }
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              POLYBENCH_JACOBI_1D_BODY1;
+            }
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              POLYBENCH_JACOBI_1D_BODY2;
+            }
+          )
 
         }
 
@@ -69,14 +72,16 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            poly_jacobi1d_lam1(i);
-          }
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            poly_jacobi1d_lam2(i);
-          }
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              poly_jacobi1d_lam1(i);
+            }
+          )
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              poly_jacobi1d_lam2(i);
+            }
+          )
 
         }
 
@@ -95,11 +100,11 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          RAJA::forall<RAJA::omp_parallel_for_exec> (RAJA::RangeSegment{1, N-1},
+          RAJA::forall<OMP_EXEC_POL> (RAJA::RangeSegment{1, N-1},
             poly_jacobi1d_lam1
           );
 
-          RAJA::forall<RAJA::omp_parallel_for_exec> (RAJA::RangeSegment{1, N-1},
+          RAJA::forall<OMP_EXEC_POL> (RAJA::RangeSegment{1, N-1},
             poly_jacobi1d_lam2
           );
 
@@ -124,5 +129,23 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 #endif
 }
 
+void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void POLYBENCH_JACOBI_2D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -36,19 +37,21 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              POLYBENCH_JACOBI_2D_BODY1;
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                POLYBENCH_JACOBI_2D_BODY1;
+              }
             }
-          }
+          )
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              POLYBENCH_JACOBI_2D_BODY2;
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                POLYBENCH_JACOBI_2D_BODY2;
+              }
             }
-          }
+          )
 
         }
 
@@ -74,19 +77,21 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
         for (Index_type t = 0; t < tsteps; ++t) {
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              poly_jacobi2d_base_lam1(i, j);
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                poly_jacobi2d_base_lam1(i, j);
+              }
             }
-          }
+          )
 
-          #pragma omp parallel for
-          for (Index_type i = 1; i < N-1; ++i ) {
-            for (Index_type j = 1; j < N-1; ++j ) {
-              poly_jacobi2d_base_lam2(i, j);
+          RAJAPERF_OMP_PARALLEL_FOR(OMP_EXEC_POL,
+            for (Index_type i = 1; i < N-1; ++i ) {
+              for (Index_type j = 1; j < N-1; ++j ) {
+                poly_jacobi2d_base_lam2(i, j);
+              }
             }
-          }
+          )
 
         }
 
@@ -111,12 +116,12 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 
       using EXEC_POL =
         RAJA::KernelPolicy<
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<0>
             >
           >,
-          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+          RAJA::statement::For<0, OMP_EXEC_POL,
             RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::Lambda<1>
             >
@@ -156,5 +161,23 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED
 #endif
 }
 
+void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
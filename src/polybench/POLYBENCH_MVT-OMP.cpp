@@ -194,5 +194,12 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_MVT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  // loops run in one parallel region with static schedules and no waits
+  // between them, so they can't take schedule tunings
+  addVariantTuningName(vid, getDefaultTuningName());
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
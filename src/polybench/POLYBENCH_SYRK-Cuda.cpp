@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_SYRK_DATA_SETUP_CUDA \
+  allocAndInitCudaDeviceData(A, m_A, n*m); \
+  allocAndInitCudaDeviceData(C, m_C, n*n);
+
+
+#define POLYBENCH_SYRK_TEARDOWN_CUDA \
+  getCudaDeviceData(m_C, C, n*n); \
+  deallocCudaDeviceData(A); \
+  deallocCudaDeviceData(C);
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_syrk(Real_ptr C, Real_ptr A,
+                          Real_type alpha, Real_type beta,
+                          Index_type n, Index_type m)
+{
+  Index_type ij = blockIdx.x * block_size + threadIdx.x;
+  if (ij < n*n) {
+    POLYBENCH_SYRK_ENTRY_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_SYRK::runCudaVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_SYRK_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n*n, block_size);
+      poly_syrk<block_size><<<grid_size, block_size>>>(C, A,
+                                                       alpha, beta,
+                                                       n, m);
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_CUDA;
+
+  } else if ( vid == Lambda_CUDA ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n*n, block_size);
+      lambda_cuda_forall<block_size><<<grid_size, block_size>>>(
+        0, n*n, [=] __device__ (Index_type ij) {
+        POLYBENCH_SYRK_ENTRY_BODY;
+      });
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_CUDA;
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(0, n*n), [=] __device__ (Index_type ij) {
+        POLYBENCH_SYRK_ENTRY_BODY;
+      });
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_CUDA;
+
+  } else {
+      getCout() << "\n  POLYBENCH_SYRK : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BIOLERPLATE(POLYBENCH_SYRK, Cuda)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
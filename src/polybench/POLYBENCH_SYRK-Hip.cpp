@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+#define POLYBENCH_SYRK_DATA_SETUP_HIP \
+  allocAndInitHipDeviceData(A, m_A, n*m); \
+  allocAndInitHipDeviceData(C, m_C, n*n);
+
+
+#define POLYBENCH_SYRK_TEARDOWN_HIP \
+  getHipDeviceData(m_C, C, n*n); \
+  deallocHipDeviceData(A); \
+  deallocHipDeviceData(C);
+
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void poly_syrk(Real_ptr C, Real_ptr A,
+                          Real_type alpha, Real_type beta,
+                          Index_type n, Index_type m)
+{
+  Index_type ij = blockIdx.x * block_size + threadIdx.x;
+  if (ij < n*n) {
+    POLYBENCH_SYRK_ENTRY_BODY;
+  }
+}
+
+
+template < size_t block_size >
+void POLYBENCH_SYRK::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_SYRK_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n*n, block_size);
+      hipLaunchKernelGGL((poly_syrk<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         C, A, alpha, beta, n, m);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_HIP;
+
+  } else if ( vid == Lambda_HIP ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      auto poly_syrk_lambda = [=] __device__ (Index_type ij) {
+        POLYBENCH_SYRK_ENTRY_BODY;
+      };
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(n*n, block_size);
+      hipLaunchKernelGGL((lambda_hip_forall<block_size, decltype(poly_syrk_lambda)>),
+        grid_size, block_size, 0, 0, 0, n*n, poly_syrk_lambda);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_HIP;
+
+  } else if ( vid == RAJA_HIP ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(0, n*n), [=] __device__ (Index_type ij) {
+        POLYBENCH_SYRK_ENTRY_BODY;
+      });
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_HIP;
+
+  } else {
+      getCout() << "\n  POLYBENCH_SYRK : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BIOLERPLATE(POLYBENCH_SYRK, Hip)
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+#define POLYBENCH_SYRK_DATA_SETUP_OMP_TARGET \
+  int hid = omp_get_initial_device(); \
+  int did = omp_get_default_device(); \
+\
+  allocAndInitOpenMPDeviceData(A, m_A, n*m, did, hid); \
+  allocAndInitOpenMPDeviceData(C, m_C, n*n, did, hid);
+
+
+#define POLYBENCH_SYRK_TEARDOWN_OMP_TARGET \
+  getOpenMPDeviceData(m_C, C, n*n, hid, did); \
+  deallocOpenMPDeviceData(A, did); \
+  deallocOpenMPDeviceData(C, did);
+
+
+void POLYBENCH_SYRK::runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_SYRK_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_OMP_TARGET;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp target is_device_ptr(A, C) device( did )
+      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type ij = 0; ij < n*n; ++ij ) {
+        POLYBENCH_SYRK_ENTRY_BODY;
+      }
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_OMP_TARGET;
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    POLYBENCH_SYRK_DATA_SETUP_OMP_TARGET;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(0, n*n), [=](Index_type ij) {
+        POLYBENCH_SYRK_ENTRY_BODY;
+      });
+
+    }
+    stopTimer();
+
+    POLYBENCH_SYRK_TEARDOWN_OMP_TARGET;
+
+  } else {
+     getCout() << "\n  POLYBENCH_SYRK : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
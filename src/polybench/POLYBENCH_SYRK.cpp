@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_SYRK::POLYBENCH_SYRK(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_SYRK, params)
+{
+  Index_type n_default = 1000;
+  Index_type m_default = 1000;
+
+  setDefaultProblemSize( n_default * n_default );
+  setDefaultReps(4);
+
+  m_n = std::sqrt( getTargetProblemSize() ) + 1;
+  m_m = m_default;
+
+  m_alpha = 0.62;
+  m_beta = 1.002;
+
+
+  setActualProblemSize( m_n * m_n );
+
+  const Index_type num_lower = m_n * (m_n + 1) / 2;
+
+  setItsPerRep( num_lower );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * num_lower +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_m );
+  setFLOPsPerRep((3 +
+                  2 * m_m) * num_lower);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( Lambda_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( Lambda_HIP );
+  setVariantDefined( RAJA_HIP );
+}
+
+POLYBENCH_SYRK::~POLYBENCH_SYRK()
+{
+}
+
+void POLYBENCH_SYRK::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  allocAndInitData(m_A, m_n * m_m, vid);
+  allocAndInitData(m_C, m_n * m_n, vid);
+}
+
+void POLYBENCH_SYRK::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_C, m_n * m_n, checksum_scale_factor );
+}
+
+void POLYBENCH_SYRK::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_A, vid);
+  deallocData(m_C, vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// POLYBENCH_SYRK kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j <= i; j++) {
+///     double dot = 0.0;
+///     for (Index_type k = 0; k < M; k++) {
+///       dot += A[i][k] * A[j][k];
+///     }
+///     C[i][j] = beta * C[i][j] + alpha * dot;
+///   }
+/// }
+///
+/// Only the lower triangle of C is updated, so work in row i grows with
+/// i. Rows are run in parallel, which makes the kernel load imbalanced
+/// unless loop iterations are scheduled to balance it.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_SYRK_HPP
+#define RAJAPerf_POLYBENCH_SYRK_HPP
+
+#define POLYBENCH_SYRK_DATA_SETUP \
+  const Index_type n = m_n; \
+  const Index_type m = m_m; \
+\
+  Real_type alpha = m_alpha; \
+  Real_type beta = m_beta; \
+\
+  Real_ptr A = m_A; \
+  Real_ptr C = m_C;
+
+
+#define POLYBENCH_SYRK_BODY1 \
+  Real_type dot = 0.0;
+
+#define POLYBENCH_SYRK_BODY2 \
+  dot += A[k + i*m] * A[k + j*m];
+
+#define POLYBENCH_SYRK_BODY3 \
+  C[j + i*n] = beta * C[j + i*n] + alpha * dot;
+
+// lower triangle of row i
+#define POLYBENCH_SYRK_ROW_BODY \
+  for (Index_type j = 0; j <= i; ++j) { \
+    POLYBENCH_SYRK_BODY1; \
+    for (Index_type k = 0; k < m; ++k) { \
+      POLYBENCH_SYRK_BODY2; \
+    } \
+    POLYBENCH_SYRK_BODY3; \
+  }
+
+// entry ij = j + i*n of C, if it is in the lower triangle
+#define POLYBENCH_SYRK_ENTRY_BODY \
+  const Index_type i = ij / n; \
+  const Index_type j = ij % n; \
+  if ( j <= i ) { \
+    POLYBENCH_SYRK_BODY1; \
+    for (Index_type k = 0; k < m; ++k) { \
+      POLYBENCH_SYRK_BODY2; \
+    } \
+    POLYBENCH_SYRK_BODY3; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_SYRK : public KernelBase
+{
+public:
+
+  POLYBENCH_SYRK(const RunParams& params);
+
+  ~POLYBENCH_SYRK();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantImpl(VariantID vid);
+  template < typename OMP_EXEC_POL >
+  void runOpenMPVariantImpl(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Index_type m_n;
+  Index_type m_m;
+
+  Real_type m_alpha;
+  Real_type m_beta;
+  Real_ptr m_A;
+  Real_ptr m_C;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
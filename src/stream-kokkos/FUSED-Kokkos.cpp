@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED.hpp"
+#if defined(RUN_KOKKOS)
+#include "common/KokkosViewUtils.hpp"
+#include <iostream>
+
+namespace rajaperf {
+namespace stream {
+
+void FUSED::runKokkosVariantUnfused(VariantID vid) {
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  auto a_view = getViewFromPointer(a, iend);
+  auto b_view = getViewFromPointer(b, iend);
+  auto c_view = getViewFromPointer(c, iend);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type dot = m_dot_init;
+
+      Kokkos::parallel_for(
+          "FUSED-Kokkos Kokkos_Lambda COPY",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) { c_view[i] = a_view[i]; });
+      Kokkos::parallel_for(
+          "FUSED-Kokkos Kokkos_Lambda MUL",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) { b_view[i] = alpha * c_view[i]; });
+      Kokkos::parallel_for(
+          "FUSED-Kokkos Kokkos_Lambda ADD",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) { c_view[i] = a_view[i] + b_view[i]; });
+      Kokkos::parallel_for(
+          "FUSED-Kokkos Kokkos_Lambda TRIAD",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i) {
+            a_view[i] = b_view[i] + alpha * c_view[i];
+          });
+      Kokkos::parallel_reduce(
+          "FUSED-Kokkos Kokkos_Lambda DOT",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i, Real_type & dot_res) {
+            dot_res += a_view[i] * b_view[i];
+          },
+          dot);
+
+      m_dot += static_cast<Real_type>(dot);
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  FUSED : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(a, a_view, iend);
+  moveDataToHostFromKokkosView(b, b_view, iend);
+  moveDataToHostFromKokkosView(c, c_view, iend);
+}
+
+void FUSED::runKokkosVariantFused(VariantID vid) {
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  auto a_view = getViewFromPointer(a, iend);
+  auto b_view = getViewFromPointer(b, iend);
+  auto c_view = getViewFromPointer(c, iend);
+
+  switch (vid) {
+
+  case Kokkos_Lambda: {
+    Kokkos::fence();
+    startTimer();
+
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type dot = m_dot_init;
+
+      Kokkos::parallel_reduce(
+          "FUSED-Kokkos Kokkos_Lambda",
+          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(ibegin, iend),
+          KOKKOS_LAMBDA(Index_type i, Real_type & dot_res) {
+            Real_type ai = a_view[i];
+            Real_type ci = ai;
+            Real_type bi = alpha * ci;
+            ci = ai + bi;
+            ai = bi + alpha * ci;
+            a_view[i] = ai;
+            b_view[i] = bi;
+            c_view[i] = ci;
+            dot_res += ai * bi;
+          },
+          dot);
+
+      m_dot += static_cast<Real_type>(dot);
+    }
+
+    Kokkos::fence();
+    stopTimer();
+
+    break;
+  }
+
+  default: {
+    std::cout << "\n  FUSED : Unknown variant id = " << vid << std::endl;
+  }
+  }
+
+  moveDataToHostFromKokkosView(a, a_view, iend);
+  moveDataToHostFromKokkosView(b, b_view, iend);
+  moveDataToHostFromKokkosView(c, c_view, iend);
+}
+
+void FUSED::runKokkosVariant(VariantID vid, size_t tune_idx) {
+  if (tune_idx == 0) {
+    runKokkosVariantUnfused(vid);
+  } else if (tune_idx == 1) {
+    runKokkosVariantFused(vid);
+  }
+}
+
+void FUSED::setKokkosTuningDefinitions(VariantID vid) {
+  addVariantTuningName(vid, "unfused");
+  addVariantTuningName(vid, "fused");
+}
+
+} // end namespace stream
+} // end namespace rajaperf
+#endif // (RUN_KOKKOS)
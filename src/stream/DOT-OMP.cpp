@@ -18,7 +18,8 @@ namespace stream
 {
 
 
-void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename OMP_EXEC_POL >
+void DOT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -37,10 +38,11 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
         Real_type dot = m_dot_init;
 
-        #pragma omp parallel for reduction(+:dot)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          DOT_BODY;
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:dot),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            DOT_BODY;
+          }
+        )
 
         m_dot += dot;
 
@@ -61,10 +63,11 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
         Real_type dot = m_dot_init;
 
-        #pragma omp parallel for reduction(+:dot)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          dot += dot_base_lam(i);
-        }
+        RAJAPERF_OMP_PARALLEL_FOR_CLAUSES(OMP_EXEC_POL, reduction(+:dot),
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            dot += dot_base_lam(i);
+          }
+        )
 
         m_dot += dot;
 
@@ -81,7 +84,7 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
         RAJA::ReduceSum<RAJA::omp_reduce, Real_type> dot(m_dot_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<OMP_EXEC_POL>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           DOT_BODY;
         });
@@ -105,5 +108,23 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+void DOT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( isOpenMPScheduleTuning(vid, tune_idx) ) {
+
+    runOpenMPVariantImpl<omp_parallel_for_runtime_exec>(vid);
+
+  } else {
+
+    runOpenMPVariantImpl<RAJA::omp_parallel_for_exec>(vid);
+
+  }
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
 } // end namespace stream
 } // end namespace rajaperf
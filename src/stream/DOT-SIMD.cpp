@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "DOT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RUN_SIMD)
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+
+template < size_t width, size_t unroll >
+void DOT::runSIMDVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DOT_DATA_SETUP;
+
+  using pack = simd::Pack<Real_type, width>;
+
+  if ( vid == Base_SIMD ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type dot = m_dot_init;
+
+      pack vdot[unroll];
+      for (size_t u = 0; u < unroll; ++u) {
+        vdot[u] = pack(0.0);
+      }
+
+      simd::forall<width, unroll>(ibegin, iend,
+        [&](Index_type i, size_t u) {
+          vdot[u] = vdot[u] + pack::load(&a[i]) * pack::load(&b[i]);
+        },
+        [&](Index_type i) {
+          DOT_BODY;
+        });
+
+      for (size_t u = 0; u < unroll; ++u) {
+        dot += reduce_sum(vdot[u]);
+      }
+
+      m_dot += dot;
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  DOT : Unknown SIMD variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_SIMD_TUNING_DEFINE_BOILERPLATE(DOT)
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif  // RUN_SIMD
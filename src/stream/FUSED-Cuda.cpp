@@ -0,0 +1,357 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_CUDA)
+
+#include "common/CudaDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+#define FUSED_DATA_SETUP_CUDA \
+  allocAndInitCudaDeviceData(a, m_a, iend); \
+  allocAndInitCudaDeviceData(b, m_b, iend); \
+  allocAndInitCudaDeviceData(c, m_c, iend);
+
+#define FUSED_DATA_TEARDOWN_CUDA \
+  getCudaDeviceData(m_a, a, iend); \
+  getCudaDeviceData(m_b, b, iend); \
+  getCudaDeviceData(m_c, c, iend); \
+  deallocCudaDeviceData(a); \
+  deallocCudaDeviceData(b); \
+  deallocCudaDeviceData(c);
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_copy(Real_ptr a, Real_ptr c, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_COPY_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_mul(Real_ptr b, Real_ptr c, Real_type alpha,
+                          Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_MUL_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_add(Real_ptr a, Real_ptr b, Real_ptr c,
+                          Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_ADD_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_triad(Real_ptr a, Real_ptr b, Real_ptr c,
+                            Real_type alpha, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_TRIAD_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_dot(Real_ptr a, Real_ptr b, Real_ptr dprod,
+                          Index_type iend)
+{
+  extern __shared__ Real_type pdot[ ];
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  Real_type dot = 0.0;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    FUSED_DOT_BODY;
+  }
+  pdot[ threadIdx.x ] = dot;
+  __syncthreads();
+
+  for ( i = block_size / 2; i > 0; i /= 2 ) {
+    if ( threadIdx.x < i ) {
+      pdot[ threadIdx.x ] += pdot[ threadIdx.x + i ];
+    }
+     __syncthreads();
+  }
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>( dprod, pdot[ 0 ] );
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
+                      Real_ptr dprod, Index_type iend)
+{
+  extern __shared__ Real_type pdot[ ];
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  Real_type dot = 0.0;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    FUSED_BODY;
+  }
+  pdot[ threadIdx.x ] = dot;
+  __syncthreads();
+
+  for ( i = block_size / 2; i > 0; i /= 2 ) {
+    if ( threadIdx.x < i ) {
+      pdot[ threadIdx.x ] += pdot[ threadIdx.x + i ];
+    }
+     __syncthreads();
+  }
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd<RAJA::cuda_atomic>( dprod, pdot[ 0 ] );
+  }
+}
+
+
+template < size_t block_size >
+void FUSED::runCudaVariantUnfused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    FUSED_DATA_SETUP_CUDA;
+
+    Real_ptr dprod;
+    allocAndInitCudaDeviceData(dprod, &m_dot_init, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      initCudaDeviceData(dprod, &m_dot_init, 1);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      fused_copy<block_size><<<grid_size, block_size>>>( a, c, iend );
+      cudaErrchk( cudaGetLastError() );
+      fused_mul<block_size><<<grid_size, block_size>>>( b, c, alpha, iend );
+      cudaErrchk( cudaGetLastError() );
+      fused_add<block_size><<<grid_size, block_size>>>( a, b, c, iend );
+      cudaErrchk( cudaGetLastError() );
+      fused_triad<block_size><<<grid_size, block_size>>>( a, b, c, alpha,
+                                                          iend );
+      cudaErrchk( cudaGetLastError() );
+      fused_dot<block_size><<<grid_size, block_size, sizeof(Real_type)*block_size>>>(
+          a, b, dprod, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Real_type lprod;
+      Real_ptr plprod = &lprod;
+      getCudaDeviceData(plprod, dprod, 1);
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_CUDA;
+
+    deallocCudaDeviceData(dprod);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    FUSED_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> dot(m_dot_init);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_COPY_BODY;
+      });
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_MUL_BODY;
+      });
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_ADD_BODY;
+      });
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_TRIAD_BODY;
+      });
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_DOT_BODY;
+      });
+
+      m_dot += static_cast<Real_type>(dot.get());
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_CUDA;
+
+  } else {
+     getCout() << "\n  FUSED : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FUSED::runCudaVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    FUSED_DATA_SETUP_CUDA;
+
+    Real_ptr dprod;
+    allocAndInitCudaDeviceData(dprod, &m_dot_init, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      initCudaDeviceData(dprod, &m_dot_init, 1);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      fused<block_size><<<grid_size, block_size, sizeof(Real_type)*block_size>>>(
+          a, b, c, alpha, dprod, iend );
+      cudaErrchk( cudaGetLastError() );
+
+      Real_type lprod;
+      Real_ptr plprod = &lprod;
+      getCudaDeviceData(plprod, dprod, 1);
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_CUDA;
+
+    deallocCudaDeviceData(dprod);
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    FUSED_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::cuda_reduce, Real_type> dot(m_dot_init);
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_BODY;
+      });
+
+      m_dot += static_cast<Real_type>(dot.get());
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_CUDA;
+
+  } else {
+     getCout() << "\n  FUSED : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void FUSED::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        runCudaVariantUnfused<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        runCudaVariantFused<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void FUSED::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "unfused_block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "fused_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_CUDA
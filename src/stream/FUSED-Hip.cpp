@@ -0,0 +1,362 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+#define FUSED_DATA_SETUP_HIP \
+  allocAndInitHipDeviceData(a, m_a, iend); \
+  allocAndInitHipDeviceData(b, m_b, iend); \
+  allocAndInitHipDeviceData(c, m_c, iend);
+
+#define FUSED_DATA_TEARDOWN_HIP \
+  getHipDeviceData(m_a, a, iend); \
+  getHipDeviceData(m_b, b, iend); \
+  getHipDeviceData(m_c, c, iend); \
+  deallocHipDeviceData(a); \
+  deallocHipDeviceData(b); \
+  deallocHipDeviceData(c);
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_copy(Real_ptr a, Real_ptr c, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_COPY_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_mul(Real_ptr b, Real_ptr c, Real_type alpha,
+                          Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_MUL_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_add(Real_ptr a, Real_ptr b, Real_ptr c,
+                          Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_ADD_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_triad(Real_ptr a, Real_ptr b, Real_ptr c,
+                            Real_type alpha, Index_type iend)
+{
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+  if (i < iend) {
+    FUSED_TRIAD_BODY;
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused_dot(Real_ptr a, Real_ptr b, Real_ptr dprod,
+                          Index_type iend)
+{
+  HIP_DYNAMIC_SHARED( Real_type, pdot)
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  Real_type dot = 0.0;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    FUSED_DOT_BODY;
+  }
+  pdot[ threadIdx.x ] = dot;
+  __syncthreads();
+
+  for ( i = block_size / 2; i > 0; i /= 2 ) {
+    if ( threadIdx.x < i ) {
+      pdot[ threadIdx.x ] += pdot[ threadIdx.x + i ];
+    }
+     __syncthreads();
+  }
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd(RAJA::hip_atomic{}, dprod, pdot[ 0 ] );
+  }
+}
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void fused(Real_ptr a, Real_ptr b, Real_ptr c, Real_type alpha,
+                      Real_ptr dprod, Index_type iend)
+{
+  HIP_DYNAMIC_SHARED( Real_type, pdot)
+
+  Index_type i = blockIdx.x * block_size + threadIdx.x;
+
+  Real_type dot = 0.0;
+  for ( ; i < iend ; i += gridDim.x * block_size ) {
+    FUSED_BODY;
+  }
+  pdot[ threadIdx.x ] = dot;
+  __syncthreads();
+
+  for ( i = block_size / 2; i > 0; i /= 2 ) {
+    if ( threadIdx.x < i ) {
+      pdot[ threadIdx.x ] += pdot[ threadIdx.x + i ];
+    }
+     __syncthreads();
+  }
+
+  if ( threadIdx.x == 0 ) {
+    RAJA::atomicAdd(RAJA::hip_atomic{}, dprod, pdot[ 0 ] );
+  }
+}
+
+
+template < size_t block_size >
+void FUSED::runHipVariantUnfused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    FUSED_DATA_SETUP_HIP;
+
+    Real_ptr dprod;
+    allocAndInitHipDeviceData(dprod, &m_dot_init, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      initHipDeviceData(dprod, &m_dot_init, 1);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((fused_copy<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         a, c, iend );
+      hipErrchk( hipGetLastError() );
+      hipLaunchKernelGGL((fused_mul<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         b, c, alpha, iend );
+      hipErrchk( hipGetLastError() );
+      hipLaunchKernelGGL((fused_add<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         a, b, c, iend );
+      hipErrchk( hipGetLastError() );
+      hipLaunchKernelGGL((fused_triad<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         a, b, c, alpha, iend );
+      hipErrchk( hipGetLastError() );
+      hipLaunchKernelGGL((fused_dot<block_size>), dim3(grid_size), dim3(block_size),
+                         sizeof(Real_type)*block_size, 0,
+                         a, b, dprod, iend );
+      hipErrchk( hipGetLastError() );
+
+      Real_type lprod;
+      Real_ptr plprod = &lprod;
+      getHipDeviceData(plprod, dprod, 1);
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_HIP;
+
+    deallocHipDeviceData(dprod);
+
+  } else if ( vid == RAJA_HIP ) {
+
+    FUSED_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::hip_reduce, Real_type> dot(m_dot_init);
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_COPY_BODY;
+      });
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_MUL_BODY;
+      });
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_ADD_BODY;
+      });
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_TRIAD_BODY;
+      });
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_DOT_BODY;
+      });
+
+      m_dot += static_cast<Real_type>(dot.get());
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_HIP;
+
+  } else {
+     getCout() << "\n  FUSED : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+template < size_t block_size >
+void FUSED::runHipVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    FUSED_DATA_SETUP_HIP;
+
+    Real_ptr dprod;
+    allocAndInitHipDeviceData(dprod, &m_dot_init, 1);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      initHipDeviceData(dprod, &m_dot_init, 1);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((fused<block_size>), dim3(grid_size), dim3(block_size),
+                         sizeof(Real_type)*block_size, 0,
+                         a, b, c, alpha, dprod, iend );
+      hipErrchk( hipGetLastError() );
+
+      Real_type lprod;
+      Real_ptr plprod = &lprod;
+      getHipDeviceData(plprod, dprod, 1);
+      m_dot += lprod;
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_HIP;
+
+    deallocHipDeviceData(dprod);
+
+  } else if ( vid == RAJA_HIP ) {
+
+    FUSED_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::hip_reduce, Real_type> dot(m_dot_init);
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        FUSED_BODY;
+      });
+
+      m_dot += static_cast<Real_type>(dot.get());
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_HIP;
+
+  } else {
+     getCout() << "\n  FUSED : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void FUSED::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        runHipVariantUnfused<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        runHipVariantFused<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+}
+
+void FUSED::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "unfused_block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "fused_block_"+std::to_string(block_size));
+
+    }
+
+  });
+}
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,230 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+
+#include "common/OpenMPTargetDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+  //
+  // Define threads per team for target execution
+  //
+  const size_t threads_per_team = 256;
+
+#define FUSED_DATA_SETUP_OMP_TARGET \
+  int hid = omp_get_initial_device(); \
+  int did = omp_get_default_device(); \
+\
+  allocAndInitOpenMPDeviceData(a, m_a, iend, did, hid); \
+  allocAndInitOpenMPDeviceData(b, m_b, iend, did, hid); \
+  allocAndInitOpenMPDeviceData(c, m_c, iend, did, hid);
+
+#define FUSED_DATA_TEARDOWN_OMP_TARGET \
+  getOpenMPDeviceData(m_a, a, iend, hid, did); \
+  getOpenMPDeviceData(m_b, b, iend, hid, did); \
+  getOpenMPDeviceData(m_c, c, iend, hid, did); \
+  deallocOpenMPDeviceData(a, did); \
+  deallocOpenMPDeviceData(b, did); \
+  deallocOpenMPDeviceData(c, did);
+
+void FUSED::runOpenMPTargetVariantUnfused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    FUSED_DATA_SETUP_OMP_TARGET;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type dot = m_dot_init;
+
+      #pragma omp target is_device_ptr(a, c) device( did )
+      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        FUSED_COPY_BODY;
+      }
+
+      #pragma omp target is_device_ptr(b, c) device( did )
+      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        FUSED_MUL_BODY;
+      }
+
+      #pragma omp target is_device_ptr(a, b, c) device( did )
+      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        FUSED_ADD_BODY;
+      }
+
+      #pragma omp target is_device_ptr(a, b, c) device( did )
+      #pragma omp teams distribute parallel for thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        FUSED_TRIAD_BODY;
+      }
+
+      #pragma omp target is_device_ptr(a, b) device( did ) map(tofrom:dot)
+      #pragma omp teams distribute parallel for reduction(+:dot) \
+              thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        FUSED_DOT_BODY;
+      }
+
+      m_dot += dot;
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_OMP_TARGET;
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    FUSED_DATA_SETUP_OMP_TARGET;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::omp_target_reduce, Real_type> dot(m_dot_init);
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        FUSED_COPY_BODY;
+      });
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        FUSED_MUL_BODY;
+      });
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        FUSED_ADD_BODY;
+      });
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        FUSED_TRIAD_BODY;
+      });
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        FUSED_DOT_BODY;
+      });
+
+      m_dot += static_cast<Real_type>(dot.get());
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_OMP_TARGET;
+
+  } else {
+     getCout() << "\n  FUSED : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+void FUSED::runOpenMPTargetVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  if ( vid == Base_OpenMPTarget ) {
+
+    FUSED_DATA_SETUP_OMP_TARGET;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Real_type dot = m_dot_init;
+
+      #pragma omp target is_device_ptr(a, b, c) device( did ) map(tofrom:dot)
+      #pragma omp teams distribute parallel for reduction(+:dot) \
+              thread_limit(threads_per_team) schedule(static, 1)
+      for (Index_type i = ibegin; i < iend; ++i ) {
+        FUSED_BODY;
+      }
+
+      m_dot += dot;
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_OMP_TARGET;
+
+  } else if ( vid == RAJA_OpenMPTarget ) {
+
+    FUSED_DATA_SETUP_OMP_TARGET;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::omp_target_reduce, Real_type> dot(m_dot_init);
+
+      RAJA::forall<RAJA::omp_target_parallel_for_exec<threads_per_team>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+        FUSED_BODY;
+      });
+
+      m_dot += static_cast<Real_type>(dot.get());
+
+    }
+    stopTimer();
+
+    FUSED_DATA_TEARDOWN_OMP_TARGET;
+
+  } else {
+     getCout() << "\n  FUSED : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+}
+
+void FUSED::runOpenMPTargetVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPTargetVariantUnfused(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPTargetVariantFused(vid);
+
+  }
+
+  t += 1;
+}
+
+void FUSED::setOpenMPTargetTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "unfused");
+
+  addVariantTuningName(vid, "fused");
+}
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_TARGET_OPENMP
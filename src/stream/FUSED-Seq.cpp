@@ -0,0 +1,196 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+
+void FUSED::runSeqVariantUnfused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type dot = m_dot_init;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FUSED_COPY_BODY;
+        }
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FUSED_MUL_BODY;
+        }
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FUSED_ADD_BODY;
+        }
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FUSED_TRIAD_BODY;
+        }
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FUSED_DOT_BODY;
+        }
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FUSED_COPY_BODY;
+        });
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FUSED_MUL_BODY;
+        });
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FUSED_ADD_BODY;
+        });
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FUSED_TRIAD_BODY;
+        });
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FUSED_DOT_BODY;
+        });
+
+        m_dot += static_cast<Real_type>(dot.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FUSED::runSeqVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FUSED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type dot = m_dot_init;
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FUSED_BODY;
+        }
+
+        m_dot += dot;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FUSED_BODY;
+        });
+
+        m_dot += static_cast<Real_type>(dot.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FUSED::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantUnfused(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runSeqVariantFused(vid);
+
+  }
+
+  t += 1;
+}
+
+void FUSED::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "unfused");
+
+  addVariantTuningName(vid, "fused");
+}
+
+} // end namespace stream
+} // end namespace rajaperf
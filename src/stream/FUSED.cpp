@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSED.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+namespace stream
+{
+
+
+FUSED::FUSED(const RunParams& params)
+  : KernelBase(rajaperf::Stream_FUSED, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(200);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(5);
+  // COPY, MUL, ADD, TRIAD, DOT
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  getActualProblemSize() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  getActualProblemSize() +
+                  (1*sizeof(Real_type) + 2*sizeof(Real_type)) *
+                  getActualProblemSize() +
+                  (1*sizeof(Real_type) + 2*sizeof(Real_type)) *
+                  getActualProblemSize() +
+                  (0*sizeof(Real_type) + 2*sizeof(Real_type)) *
+                  getActualProblemSize() );
+  setFLOPsPerRep(6 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature( Forall );
+  setUsesFeature( Reduction );
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_OpenMPTarget );
+  setVariantDefined( RAJA_OpenMPTarget );
+
+  setVariantDefined( Base_CUDA );
+  setVariantDefined( RAJA_CUDA );
+
+  setVariantDefined( Base_HIP );
+  setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Kokkos_Lambda );
+}
+
+FUSED::~FUSED()
+{
+}
+
+Index_type FUSED::getBytesMovedPerRep(VariantID vid, size_t tune_idx) const
+{
+  // fused loop reads a and writes a, b, and c
+  if ( getVariantTuningName(vid, tune_idx).compare(0, 5, "fused") == 0 ) {
+    return (1*sizeof(Real_type) + 3*sizeof(Real_type)) *
+           getActualProblemSize();
+  }
+  return getBytesPerRep();
+}
+
+void FUSED::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_a, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_b, getActualProblemSize(), 0.0, vid);
+  allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+
+  // with alpha^2 + 2*alpha = 1, each pass leaves a unchanged, so values
+  // neither grow nor decay to denormals over many reps
+  m_alpha = std::sqrt(2.0) - 1.0;
+
+  m_dot = 0.0;
+  m_dot_init = 0.0;
+}
+
+void FUSED::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_a, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid][tune_idx] += calcChecksum(m_b, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid][tune_idx] += m_dot;
+}
+
+void FUSED::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_a, vid);
+  deallocData(m_b, vid);
+  deallocData(m_c, vid);
+}
+
+} // end namespace stream
+} // end namespace rajaperf
@@ -0,0 +1,156 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FUSED kernel reference implementation:
+///
+/// "unfused" tuning; STREAM kernels run one after another on shared arrays:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   c[i] = a[i] ;                   // COPY
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   b[i] = alpha * c[i] ;           // MUL
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   c[i] = a[i] + b[i] ;            // ADD
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   a[i] = b[i] + alpha * c[i] ;    // TRIAD
+/// }
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   dot += a[i] * b[i] ;            // DOT
+/// }
+///
+/// "fused" tuning; one loop with values carried in registers:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Real_type ai = a[i] ;
+///   Real_type ci = ai ;
+///   Real_type bi = alpha * ci ;
+///   ci = ai + bi ;
+///   ai = bi + alpha * ci ;
+///   a[i] = ai ; b[i] = bi ; c[i] = ci ;
+///   dot += ai * bi ;
+/// }
+///
+/// Bytes per rep are those moved by the unfused loops, so the ratio of the
+/// times of the two tunings is the saving from fusion. Bytes moved per rep
+/// of fused tunings are those of the fused loop, which reads a and writes
+/// a, b, and c.
+///
+
+#ifndef RAJAPerf_Stream_FUSED_HPP
+#define RAJAPerf_Stream_FUSED_HPP
+
+#define FUSED_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b; \
+  Real_ptr c = m_c; \
+  Real_type alpha = m_alpha;
+
+#define FUSED_COPY_BODY  \
+  c[i] = a[i] ;
+
+#define FUSED_MUL_BODY  \
+  b[i] = alpha * c[i] ;
+
+#define FUSED_ADD_BODY  \
+  c[i] = a[i] + b[i] ;
+
+#define FUSED_TRIAD_BODY  \
+  a[i] = b[i] + alpha * c[i] ;
+
+#define FUSED_DOT_BODY  \
+  dot += a[i] * b[i] ;
+
+#define FUSED_BODY  \
+  Real_type ai = a[i] ; \
+  Real_type ci = ai ; \
+  Real_type bi = alpha * ci ; \
+  ci = ai + bi ; \
+  ai = bi + alpha * ci ; \
+  a[i] = ai ; \
+  b[i] = bi ; \
+  c[i] = ci ; \
+  dot += ai * bi ;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace stream
+{
+
+class FUSED : public KernelBase
+{
+public:
+
+  FUSED(const RunParams& params);
+
+  ~FUSED();
+
+  Index_type getBytesMovedPerRep(VariantID vid, size_t tune_idx) const;
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t tune_idx);
+  void runHipVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runKokkosVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setCudaTuningDefinitions(VariantID vid);
+  void setHipTuningDefinitions(VariantID vid);
+  void setOpenMPTargetTuningDefinitions(VariantID vid);
+  void setKokkosTuningDefinitions(VariantID vid);
+
+  void runSeqVariantUnfused(VariantID vid);
+  void runSeqVariantFused(VariantID vid);
+  void runOpenMPVariantUnfused(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid);
+  void runOpenMPTargetVariantUnfused(VariantID vid);
+  void runOpenMPTargetVariantFused(VariantID vid);
+  void runKokkosVariantUnfused(VariantID vid);
+  void runKokkosVariantFused(VariantID vid);
+
+  template < size_t block_size >
+  void runCudaVariantUnfused(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantFused(VariantID vid);
+
+  template < size_t block_size >
+  void runHipVariantUnfused(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantFused(VariantID vid);
+
+private:
+  static const size_t default_gpu_block_size = 256;
+  using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+  Real_ptr m_c;
+  Real_type m_alpha;
+
+  Real_type m_dot;
+  Real_type m_dot_init;
+};
+
+} // end namespace stream
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "gtest/gtest.h"
+
+#include "common/Executor.hpp"
+#include "common/KernelBase.hpp"
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+//
+// Run Stream kernels with arrays longer than the largest 32-bit int on
+// sequential and OpenMP variants. Each array takes ~17 GB, so this test
+// is only built when RAJA_PERFSUITE_ENABLE_LARGE_SIZE_TESTS is on.
+//
+TEST(LargeSizeSuiteTest, Basic)
+{
+
+// Assemble command line args for large size test
+  std::vector< std::string > sargv;
+  sargv.push_back( std::string("dummy ") );  // for executable name
+  sargv.push_back( std::string("--checkrun") );
+  sargv.push_back( std::string("1") );
+  sargv.push_back( std::string("--show-progress") );
+  sargv.push_back( std::string("--size") );
+  sargv.push_back( std::string("2200000000") );
+  sargv.push_back( std::string("--kernels") );
+  sargv.push_back( std::string("Stream") );
+  sargv.push_back( std::string("--variants") );
+  sargv.push_back( std::string("Base_Seq") );
+  sargv.push_back( std::string("RAJA_Seq") );
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  sargv.push_back( std::string("Base_OpenMP") );
+  sargv.push_back( std::string("RAJA_OpenMP") );
+#endif
+
+  int argc = static_cast<int>(sargv.size());
+  char** argv = new char* [argc];
+  for (int is = 0; is < argc; ++is) { 
+    argv[is] = const_cast<char*>(sargv[is].c_str());
+  }
+
+  // STEP 1: Create suite executor object with input args defined above
+  rajaperf::Executor executor(argc, argv);
+
+  // STEP 2: Assemble kernels and variants to run
+  executor.setupSuite();
+
+  // STEP 3: Report suite run summary
+  executor.reportRunSummary(std::cout);
+
+  // STEP 4: Execute suite
+  executor.runSuite();
+
+  // STEP 5: Access suite run data and run through checks
+  std::vector<rajaperf::KernelBase*> kernels = executor.getKernels();
+  std::vector<rajaperf::VariantID> variant_ids = executor.getVariantIDs();
+
+  EXPECT_GT(kernels.size(), 0u);
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+
+    rajaperf::KernelBase* kernel = kernels[ik];
+
+    EXPECT_GT(kernel->getActualProblemSize(),
+              static_cast<rajaperf::Index_type>(
+                std::numeric_limits<int>::max()));
+
+    // 
+    // Get reference checksum (first kernel variant run)
+    //
+    rajaperf::Checksum_type cksum_ref = 0.0;
+    size_t ivck = 0;
+    bool found_ref = false;
+    while ( ivck < variant_ids.size() && !found_ref ) {
+
+      rajaperf::VariantID vid = variant_ids[ivck];
+      size_t num_tunings = kernel->getNumVariantTunings(vid);
+      for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+        if ( kernel->wasVariantTuningRun(vid, tune_idx) ) {
+          cksum_ref = kernel->getChecksum(vid, tune_idx);
+          found_ref = true;
+          break;
+        }
+      }
+      ++ivck;
+
+    } // while loop over variants until reference checksum found
+
+    EXPECT_TRUE(found_ref);
+
+    //
+    // Check execution time is greater than zero and relative checksum
+    // diff is within tolerance for each variant run; checksums of long
+    // arrays are large so an absolute tolerance is not meaningful.
+    // 
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+
+      rajaperf::VariantID vid = variant_ids[iv];
+
+      size_t num_tunings = kernel->getNumVariantTunings(variant_ids[iv]);
+      for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+        if ( kernel->wasVariantTuningRun(vid, tune_idx) ) {
+
+          double rtime = kernel->getTotTime(vid, tune_idx);
+
+          rajaperf::Checksum_type cksum = kernel->getChecksum(vid, tune_idx); 
+          rajaperf::Checksum_type cksum_diff = std::abs(cksum_ref - cksum);
+          rajaperf::Checksum_type cksum_scale =
+            std::max(std::abs(cksum_ref), static_cast<rajaperf::Checksum_type>(1.0));
+
+          // Print kernel information when running test manually
+          std::cout << "Check kernel, variant, tuning : "
+                    << kernel->getName() << " , "
+                    << rajaperf::getVariantName(vid) << " , "
+                    << kernel->getVariantTuningName(vid, tune_idx) 
+                    << std::endl;
+          EXPECT_GT(rtime, 0.0);
+          EXPECT_LT(cksum_diff / cksum_scale, 1e-10);
+          
+        }
+      } 
+
+    }  // loop over variants
+
+  } // loop over kernels
+
+  // clean up 
+  delete [] argv; 
+}